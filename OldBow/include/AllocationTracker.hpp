@@ -0,0 +1,106 @@
+/**
+ * @file AllocationTracker.hpp
+ * @brief AllocationTracker and AllocationScope class definitions
+ * @details Declares the opt-in heap allocation tracker. Built with -DOLDBOW_TRACK_ALLOCATIONS,
+ * the global operator new is replaced and every allocation is counted per frame against the
+ * subsystem tag of the allocating thread. Without the flag nothing is replaced and the
+ * scoped tags compile to nothing.
+ */
+
+#ifndef ALLOCATIONTRACKER_HPP
+#define ALLOCATIONTRACKER_HPP
+
+#include <SDL.h>
+
+/// Subsystems allocations are attributed to
+enum class AllocationTag {
+    Other,         ///< Anything outside a tagged scope (EX: scene start up)
+    SceneUpdate,   ///< Input and simulation of a frame
+    BossPatterns,  ///< Boss attack patterns, nested in the scene update
+    Render,        ///< Recording the snapshot, drawing and presenting
+    Dialogue,      ///< Dialogue loading, streaming and prefetching
+    Count
+};
+
+/// Allocations of one tag over one frame
+struct AllocationStats {
+    Uint64 allocations = 0;  ///< Number of operator new calls
+    Uint64 bytes = 0;        ///< Bytes requested
+};
+
+/**
+ * @brief Counts heap allocations per frame and subsystem
+ * @details Counters are atomics updated with relaxed ordering, so the simulation thread, the main
+ * thread and the dialogue loader all count without locks. endFrame() moves the counters into the
+ * last frame's stats and appends a row to the dump file (only for frames that allocated).
+ * Every call is a no-op when tracking is not compiled in.
+ */
+class AllocationTracker {
+public:
+#ifdef OLDBOW_TRACK_ALLOCATIONS
+    static constexpr bool Enabled = true;
+#else
+    static constexpr bool Enabled = false;
+#endif
+
+    /**
+     * @brief Start counting frames and open the dump file
+     * @param dumpPath CSV file written with one row per frame that allocated
+     */
+    static void beginSession(const char* dumpPath);
+
+    /**
+     * @brief Close the current frame: publish its counts and write them to the dump file
+     * @details Call once per frame, once no thread is allocating for that frame anymore
+     */
+    static void endFrame();
+
+    /**
+     * @brief Close the dump file and log a summary per tag
+     */
+    static void endSession();
+
+    /**
+     * @brief Get the allocations of the last closed frame
+     * @param tag Subsystem
+     */
+    static AllocationStats getLastFrame(AllocationTag tag);
+
+    /**
+     * @brief Get the display name of a tag (EX: "boss patterns")
+     */
+    static const char* getTagName(AllocationTag tag);
+
+    /**
+     * @brief Set the tag of the calling thread
+     * @param tag New tag
+     * @return Previous tag
+     */
+    static AllocationTag setTag(AllocationTag tag);
+};
+
+/**
+ * @brief Attributes the allocations of the calling thread to a subsystem until the end of the scope
+ * @details Scopes nest, the previous tag is restored on exit
+ * @example
+ * AllocationScope tag(AllocationTag::BossPatterns);
+ */
+class AllocationScope {
+public:
+#ifdef OLDBOW_TRACK_ALLOCATIONS
+    explicit AllocationScope(AllocationTag tag) : mPrevious(AllocationTracker::setTag(tag)) {}
+    ~AllocationScope() { AllocationTracker::setTag(mPrevious); }
+#else
+    explicit AllocationScope(AllocationTag) {}
+#endif
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+#ifdef OLDBOW_TRACK_ALLOCATIONS
+    /// Tag restored when the scope ends
+    AllocationTag mPrevious;
+#endif
+};
+
+#endif // ALLOCATIONTRACKER_HPP
@@ -9,6 +9,7 @@
 #define APPLICATION_HPP
 
 #include <SDL.h>
+#include <atomic>
 #include <stdexcept>
 #include <vector>
 #include "TextureComponent.hpp"
@@ -18,27 +19,30 @@
 #include "Projectile.hpp"
 #include "Scene.hpp"
 #include "DialogueManager.hpp"
+#include "FramePacer.hpp"
+#include "DebugOverlay.hpp"
+#include "RenderScaler.hpp"
+#include "LayerCompositor.hpp"
+#include "GameState.hpp"
+#include "FrameSnapshot.hpp"
+#include "TripleBuffer.hpp"
+#include "SimulationThread.hpp"
 
-/// GameState enum controls overall game flow
-enum class GameState {
-    /// Player is currently in reading plot
-    Dialogue,
-    /// Player is currently in battle stage
-    Playing,
-    /// Player has been defeated
-    Defeat,
-    /// Player has cleared all stages
-    Victory
-};
-
-/// Global dialogue manager to control dialogue progression
+/**
+ * @brief Global dialogue manager to control dialogue progression
+ * @note Owned by the simulation: only touched by the simulation thread, or by the main thread
+ * while the simulation thread is idle. The renderer reads it through FrameSnapshot.
+ */
 extern DialogueManager dialogueManager;
 
-/// Global game state tracker
+/**
+ * @brief Global game state tracker
+ * @note Same ownership as dialogueManager
+ */
 extern GameState currentState;
 
-/// Global flag to check if the application exiting
-extern bool isExiting;
+/// Global flag to check if the application exiting, safe to read from any thread
+extern std::atomic<bool> isExiting;
 
 /**
  * @brief Main Application class
@@ -62,6 +66,83 @@ private:
 
     SDL_Color currentColor;   // Current background color (RGBA)
 
+    /// Keeps the main loop at the target frame rate and records frame times
+    FramePacer mFramePacer;
+
+    /// Frame statistics overlay, toggled with F3
+    DebugOverlay mOverlay;
+
+    /// Keeps the background and gameplay layers in render targets and puts them on the window
+    LayerCompositor mCompositor;
+
+    /// Picks the resolution of the layers that holds the frame budget
+    RenderScaler mScaler;
+
+    /// Glyphs for dialogue text, built once at start up
+    GlyphAtlas mDialogueFont;
+
+    /// Rasterizes the dialogue font while the window and renderer are created
+    SDL_Thread* mFontThread = nullptr;
+
+    /// Time the font thread took, in milliseconds
+    double mFontMs = 0.0;
+
+    /// Set by the font thread when the atlas image is ready to upload
+    bool mFontRasterized = false;
+
+    /// Dialogue line currently laid out in the cached geometry
+    std::string mCachedLine;
+
+    /// Cached geometry of the wrapped dialogue line
+    std::vector<SDL_Vertex> mLineVertices;
+    std::vector<int> mLineIndices;
+
+    /// Runs the simulation of the next frame while the main thread renders the previous one
+    SimulationThread mSimulation;
+
+    /**
+     * @brief Frame snapshots handed from the simulation to the renderer
+     * @details The simulation thread publishes each finished frame, the main thread draws the
+     * latest one; neither waits for the other
+     */
+    TripleBuffer<FrameSnapshot> mSnapshots;
+
+    /// Time the last simulated frame took, read after the simulation thread is joined
+    double mLastSimulationMs = 0.0;
+
+    /// Set when the window is closed, ends the main loop
+    bool mQuitRequested = false;
+
+    /// Next frame waits for events instead of running at the target frame rate (dialogue / end screens)
+    bool mIdle = false;
+
+    /// Set when the window has to be drawn again whatever the snapshot (EX: exposed, resized)
+    bool mRedraw = true;
+
+    /// What the last presented frame showed, an idle frame is only drawn when this changes
+    GameState mShownState = GameState::Dialogue;
+    SDL_Texture* mShownBackground = nullptr;
+    bool mShownDialogue = false;
+    std::string mShownLine;
+
+    /**
+     * @brief Check if a snapshot shows what is already on screen
+     * @details Only meaningful outside the Playing state, where the dialogue is all that is drawn
+     * @param frame Snapshot to compare
+     */
+    bool isShown(const FrameSnapshot& frame) const;
+
+    /**
+     * @brief Font thread body: rasterize the dialogue font
+     * @param data The Application that owns the thread
+     */
+    static int rasterizeFont(void* data);
+
+    /**
+     * @brief Wait for the font thread, if it is running
+     */
+    void joinFontThread();
+
 // Public method signatures
 public:
 
@@ -82,17 +163,27 @@ public:
 
     /**
      * @brief Runs the main game loop, handling input, updates, and rendering at a given fixed frame rate
+     * @details Pipelined over two threads: frame N+1 is simulated on the simulation thread while
+     * the main thread draws and presents frame N, so what is shown lags the simulation by at most one frame
      * @param TargetFPS Target frames per second for the game loop
      */
     void loop(int TargetFPS);
 
     /**
-     * @brief Renders text to the screen at a specified location
+     * @brief Enable or disable presenting with vsync
+     * @param enabled True to wait for vsync in SDL_RenderPresent
+     */
+    void setVSync(bool enabled);
+
+    /**
+     * @brief Renders word wrapped text to the screen at a specified location
+     * @details The layout is cached, so drawing the same message again costs one draw call
      * @param message The text message to render
      * @param x The x coordinate to start rendering the text
      * @param y The y coordinate to start rendering the text
+     * @param maxWidth Width at which lines are wrapped
      */
-    void renderText(const std::string& message, int x, int y);
+    void renderText(const std::string& message, int x, int y, int maxWidth);
 
 // Private method signatures
 private:
@@ -112,9 +203,18 @@ private:
 
     /**
     * @brief Main Game Loop render(),
-    * render all updated game entities and text to the screen
+    * render a simulated frame and the dialogue text to the screen
+    * @note Presenting is done by the loop so it can be timed on its own
+    * @param frame Snapshot of the frame to draw
+    */
+    void render(const FrameSnapshot& frame);
+
+    /**
+    * @brief Record the current scene, dialogue and UI state into a snapshot
+    * @details Called by whichever thread owns the simulation at that moment
+    * @param snapshot Snapshot to fill
     */
-    void render();
+    void recordSnapshot(FrameSnapshot& snapshot);
 };
 
 #endif // APPLICATION_HPP
@@ -11,15 +11,11 @@
 #include "Enemy.hpp"
 #include "Projectile.hpp"
 #include "Player.hpp"
+#include "CompiledAssets.hpp"
 #include <string>
 #include <vector>
 #include <memory>
-
-/// @brief enum for boss identifiers
-enum class BossID { Boss1, Boss2, Boss3 };
-
-/// @brief enum for boss attack pattern types
-enum class PatternType { Rain, Spread, Ultimate, GhostFire, Slash };
+#include <random>
 
 /// @brief Boss class derived from Enemy
 /// @details Manages boss behavior, attack patterns, health, and rendering
@@ -38,6 +34,13 @@ public:
      */
     void update(float deltaTime) override;
 
+    /**
+     * @brief Register the attack patterns and the ultimate on the scene's timer wheel
+     * @details Called once by the scene after the configuration is loaded
+     * @param timers Timer wheel of the scene
+     */
+    void startTimers(TimerWheel& timers) override;
+
     /**
      * @brief Set boss current HP
      * @param hp Hit points to set
@@ -92,10 +95,28 @@ public:
 
     /**
      * @brief Load boss configuration from external file
+     * @details Uses the compiled blob next to the file when available (see CompiledAssets)
      * @param filePath Path to configuration file
      */
     void loadFromFile (const std::string& filePath);
 
+    /**
+     * @brief Apply a loaded boss configuration
+     * @param definition Boss definition (EX: kept by a scene checkpoint)
+     */
+    void applyDefinition(const CompiledAssets::BossDefinition& definition);
+
+    /**
+     * @brief Get the configuration the boss was loaded with
+     * @return Boss definition, its hp is the maximum HP
+     */
+    CompiledAssets::BossDefinition getDefinition() const;
+
+    /**
+     * @brief Random engine driving boss direction changes, saved and restored by scene checkpoints
+     */
+    static std::mt19937& directionEngine();
+
     /**
      * @brief Set boss maximum HP
      * @param hp Maximum hit points
@@ -129,7 +150,7 @@ private:
     int mHP = 10;
 
     /// @brief Maximum HP of the boss
-    int mMaxHP;
+    int mMaxHP = 10;
 
     /// @brief Player reference for tracking attacks
     std::shared_ptr<Player> mPlayer;
@@ -137,7 +158,7 @@ private:
     /// @brief Path to boss texture asset
     std::string mTexturePath;
 
-    /// @brief Cooldown timers for various attacks
+    /// @brief Delay before the first shot of each attack
     float mRainCooldown;
     float mSpreadCooldown;
     float mUltimateCooldown;
@@ -150,18 +171,18 @@ private:
     float mGhostFireRate;
     float mSlashFireRate;
 
-    /// @brief Timer for triggering ultimate attack
+    /// @brief Delay before the first ultimate attack
     float mUltimateTimer;
 
     /// @brief Fire rate for ultimate attack
     float mUltimateFireRate;
 
-    /// @brief Duration timer for ultimate fire period
-    float mUltimateFirePeriodTimer;
-
-    /// @brief Default duration of the ultimate fire period
+    /// @brief Duration of the ultimate fire period
     float mUltimateFirePeriodDefault;
 
+    /// @brief True while an ultimate fire period is running (Dragon Breath every frame)
+    bool mUltimateFiring = false;
+
     /// @brief Boss name, default "Unnamed"
     std::string mName = "Unnamed Boss";
 
@@ -184,7 +205,7 @@ private:
     float mUltimateProjectileHeight;
 
     /// @brief Identifier for boss type
-    BossID mID;
+    BossID mID = BossID::Boss1;
 
     /**
      * @brief Fire a straight rain of projectiles upward then downward when top is reached
@@ -212,9 +233,27 @@ private:
     void slash();
 
     /**
-     * @brief Reset ultimate fire period timer to default value
+     * @brief Fire one attack pattern
+     * @param pattern Pattern to fire
+     * @return Delay before the pattern fires again (in seconds)
+     */
+    float firePattern(PatternType pattern);
+
+    /**
+     * @brief Schedule the next shot of an attack pattern
+     * @param timers Timer wheel of the scene
+     * @param pattern Pattern to fire
+     * @param delay Delay before the shot (in seconds)
+     */
+    void schedulePattern(TimerWheel& timers, PatternType pattern, float delay);
+
+    /**
+     * @brief Schedule the next start or end of the ultimate fire period
+     * @param timers Timer wheel of the scene
+     * @param firing State the ultimate switches to
+     * @param delay Delay before the switch (in seconds)
      */
-    void resetUltFirePeriod() { mUltimateFirePeriodTimer = mUltimateFirePeriodDefault; }
+    void scheduleUltimate(TimerWheel& timers, bool firing, float delay);
 };
 
 #endif  // BOSS_HPP
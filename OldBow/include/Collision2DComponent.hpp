@@ -8,14 +8,49 @@
 #ifndef COLLISION2DCOMPONENT_HPP
 #define COLLISION2DCOMPONENT_HPP
 #include "Component.hpp"
+#include "TransformComponent.hpp"
 
+/**
+ * @brief Collision layer bits
+ * @details Every hitbox sits on one layer and lists the layers it collides with in its mask.
+ * Two hitboxes are tested only if either one's mask contains the other's layer.
+ */
+namespace CollisionLayer {
+    constexpr Uint32 None = 0;
+    constexpr Uint32 Player = 1u << 0;             ///< Main character
+    constexpr Uint32 PlayerProjectile = 1u << 1;   ///< Arrows fired by the player
+    constexpr Uint32 Enemy = 1u << 2;              ///< Undead archers
+    constexpr Uint32 Boss = 1u << 3;               ///< Bosses
+    constexpr Uint32 HostileProjectile = 1u << 4;  ///< Anything fired by enemies or bosses
+}
+
+
+/// Shape of a hitbox
+enum class HitboxShape {
+    Box,         ///< Axis-aligned rectangle, ignores rotation
+    Circle,      ///< Circle inscribed in the (modified) rectangle
+    OrientedBox  ///< Rectangle rotated with the transform
+};
+
+/**
+ * @brief Exact hitbox geometry used by the narrow phase
+ * @details For every shape the center and bounding radius are filled in,
+ * so a pair can be rejected by a circle test before the exact one.
+ */
+struct HitboxGeometry {
+    HitboxShape shape = HitboxShape::Box;
+    float centerX = 0.0f, centerY = 0.0f;
+    float halfWidth = 0.0f, halfHeight = 0.0f;  ///< Half extents along the box axes (radius for circles)
+    float axisX = 1.0f, axisY = 0.0f;           ///< Unit vector of the box's local x axis (cos, sin of the rotation)
+    float boundingRadius = 0.0f;                ///< Radius of the circle enclosing the shape
+};
 
 /**
  * @brief Component representing a 2D collision hitbox
  * @details Calculates and provides the collision rectangle for the owning entity,
  * with adjustable width and height modifiers for hitbox forgiveness.
  */
-class Collision2DComponent : public Component {
+class Collision2DComponent final : public Component {
 
 private:
     /**
@@ -24,6 +59,15 @@ private:
      */
     SDL_FRect mRectangle;
 
+    /**
+     * @brief Collision bounds at the previous sync
+     * @details Used to sweep fast projectiles along the path they covered in one step
+     */
+    SDL_FRect mPreviousRectangle{0, 0, 0, 0};
+
+    /// False until the first sync, so a new hitbox does not sweep from the origin
+    bool mHasPrevious = false;
+
     /**
      * @brief Width scaling modifier for hitbox size
      * @details Default is 1.0 (full size). Can be reduced for hitbox forgiveness.
@@ -36,6 +80,15 @@ private:
      */
     float mHeightModifier = 1.0f;
 
+    /// Shape and exact geometry of the hitbox
+    HitboxGeometry mGeometry;
+
+    /// Layer this hitbox is on
+    Uint32 mLayer = CollisionLayer::None;
+
+    /// Layers this hitbox collides with
+    Uint32 mMask = CollisionLayer::None;
+
 public:
 
     /**
@@ -84,17 +137,71 @@ public:
      */
     void setHitboxModifier(float widthMod, float heightMod);
 
+    /**
+     * @brief Set the hitbox shape
+     * @details Circles and oriented boxes follow rotating sprites closely, so they
+     * need much less hitbox forgiveness than an axis-aligned box
+     * @param shape New shape
+     */
+    void setShape(HitboxShape shape) { mGeometry.shape = shape; }
+
+    /**
+     * @brief Get the exact hitbox geometry
+     * @details getRectangle() stays the axis-aligned bounds of the shape, used by the broad phase
+     * @return Geometry computed by the last sync()
+     */
+    const HitboxGeometry& getGeometry() const { return mGeometry; }
+
+    /**
+     * @brief Set the collision layer and mask
+     * @param layer Layer bit this hitbox is on (EX: CollisionLayer::Enemy)
+     * @param mask Layer bits this hitbox collides with
+     */
+    void setLayer(Uint32 layer, Uint32 mask) { mLayer = layer; mMask = mask; }
+
+    /**
+     * @brief Get the collision layer
+     * @return Layer bit of this hitbox
+     */
+    Uint32 getLayer() const { return mLayer; }
+
+    /**
+     * @brief Get the collision mask
+     * @return Layer bits this hitbox collides with
+     */
+    Uint32 getMask() const { return mMask; }
+
     /**
      * @brief Get the collision rectangle
      * @details Returns the SDL_FRect representing the current collision bounds.
      * Used for collision detection with other entities.
      * @return Collision rectangle
      */
-    SDL_FRect getRectangle() { return mRectangle; }
+    SDL_FRect getRectangle() const { return mRectangle; }
+
+    /**
+     * @brief Get the collision rectangle of the previous sync
+     * @return Collision rectangle one step ago
+     */
+    SDL_FRect getPreviousRectangle() const { return mPreviousRectangle; }
 
     // Updates the collision bounds to match the associated TransformComponent
     void update(float deltaTime) override;
 
+    /**
+     * @brief Move the collision bounds to the given transform
+     * @details Non-virtual, used by the scene's collision pass
+     * @param transform Transform of the owning entity
+     */
+    void sync(const TransformComponent& transform);
+
+    /**
+     * @brief Forget the previous bounds
+     * @details Call when the owner is placed instead of moved, the next sync() then starts
+     * from the new position instead of sweeping across the jump
+     */
+    void resetSweep() { mHasPrevious = false; }
+
 
     /**
      * @brief Debug function: render the collision rectangle
@@ -0,0 +1,131 @@
+/**
+ * @file CollisionSystem.hpp
+ * @brief CollisionSystem class definition
+ * @details Declares the scene-wide collision pass: hitboxes are gathered into flat records,
+ * sorted into a uniform grid, and every overlapping pair allowed by the layer masks
+ * is reported once in a contact list.
+ */
+
+#ifndef COLLISIONSYSTEM_HPP
+#define COLLISIONSYSTEM_HPP
+
+#include <SDL.h>
+#include <vector>
+#include "Collision2DComponent.hpp"
+
+class GameEntity;
+
+/// One hitbox registered for the current frame
+struct Collider {
+    GameEntity* entity;       ///< Entity owning the hitbox
+    SDL_FRect rect;           ///< Axis-aligned bounds
+    SDL_FRect previous;       ///< Axis-aligned bounds one step ago
+    SDL_FRect bounds;         ///< Area used by the broad phase (covers the sweep for swept colliders)
+    bool swept;               ///< True if it moved further than its own size in one step
+    HitboxGeometry geometry;  ///< Exact shape, used by the narrow phase
+    Uint32 layer;             ///< Layer bit (see CollisionLayer)
+    Uint32 mask;              ///< Layers it collides with
+    int tag;                  ///< Caller defined value (EX: who fired a projectile)
+};
+
+/// A pair of overlapping hitboxes, as indices into the collider list
+struct Contact {
+    int first;
+    int second;
+};
+
+/**
+ * @brief Finds every overlapping hitbox pair of a scene in one pass
+ * @details Colliders are bucketed into 128 px grid cells, so only hitboxes sharing a cell
+ * are compared and the cost grows linearly with the number of entities.
+ * A pair spanning several cells is only reported by the cell holding the top left corner
+ * of their overlap. Box pairs use the plain AABB test; pairs involving a circle or an
+ * oriented box are first rejected by their bounding circles, then tested exactly (SAT).
+ * Colliders that moved further than their own size in one step (EX: player arrows at the
+ * 0.1 s deltaTime clamp) are swept: their boxes are tested over the whole step, so they
+ * cannot tunnel through a target between two frames.
+ */
+class CollisionSystem {
+public:
+
+    /**
+     * @brief Constructor, sizes the grid to the window
+     */
+    CollisionSystem();
+
+    /**
+     * @brief Remove all colliders and contacts of the previous frame
+     */
+    void clear();
+
+    /**
+     * @brief Register an entity's hitbox for this frame
+     * @details Entities without a Collision2DComponent or layer are ignored
+     * @param entity Entity to register
+     * @param tag Caller defined value copied into the collider
+     */
+    void add(GameEntity& entity, int tag = 0);
+
+    /**
+     * @brief Find every overlapping pair allowed by the layer masks
+     */
+    void detect();
+
+    /**
+     * @brief Get the contacts found by the last detect()
+     */
+    const std::vector<Contact>& getContacts() const { return mContacts; }
+
+    /**
+     * @brief Get a registered collider
+     * @param index Index from a Contact
+     */
+    const Collider& getCollider(int index) const { return mColliders[index]; }
+
+    /**
+     * @brief Match a contact against two layers
+     * @param contact Contact to check
+     * @param layerA Layer expected on one side
+     * @param layerB Layer expected on the other side
+     * @param a Set to the collider on layerA
+     * @param b Set to the collider on layerB
+     * @return True if the contact is between layerA and layerB
+     */
+    bool match(const Contact& contact, Uint32 layerA, Uint32 layerB, const Collider*& a, const Collider*& b) const;
+
+private:
+    /// Size of one grid cell in pixels
+    static constexpr float CellSize = 128.0f;
+
+    /// Grid dimensions in cells
+    int mColumns;
+    int mRows;
+
+    /// Colliders registered this frame
+    std::vector<Collider> mColliders;
+
+    /// Collider indices per grid cell, kept between frames to reuse their memory
+    std::vector<std::vector<int>> mCells;
+
+    /// Contacts found this frame
+    std::vector<Contact> mContacts;
+
+    /**
+     * @brief Exact overlap test of two hitboxes whose bounds already overlap
+     */
+    static bool shapesOverlap(const Collider& a, const Collider& b);
+
+    /**
+     * @brief Swept AABB test of two boxes moving linearly over the last step
+     * @return True if they touched at any time during the step
+     */
+    static bool sweptOverlap(const Collider& a, const Collider& b);
+
+    /**
+     * @brief Get the grid cell of a point, clamped to the grid
+     */
+    int cellColumn(float x) const;
+    int cellRow(float y) const;
+};
+
+#endif // COLLISIONSYSTEM_HPP
@@ -0,0 +1,175 @@
+/**
+ * @file CompiledAssets.hpp
+ * @brief Boss and dialogue definitions, text parsers and compiled binary blobs
+ * @details Declares the in-memory definitions loaded from the Assets folder, the validating
+ * text parsers used by the offline asset compiler, and the compact binary format the runtime
+ * loads with a single read. This header has no SDL dependency so tools can share it.
+ */
+
+#ifndef COMPILEDASSETS_HPP
+#define COMPILEDASSETS_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/// @brief enum for boss identifiers
+enum class BossID : std::uint8_t { Boss1, Boss2, Boss3 };
+
+/// @brief enum for boss attack pattern types
+enum class PatternType : std::uint8_t { Rain, Spread, Ultimate, GhostFire, Slash };
+
+/**
+ * @brief Namespace for loading, validating and compiling data-driven assets
+ * @details Text files (Boss1.txt, Scene1Start.txt, ...) stay the source of truth.
+ * The offline compiler (tools/AssetCompiler.cpp) validates them and writes a ".bin" blob next
+ * to each one; the runtime prefers the blob and falls back to the text file in dev builds.
+ */
+namespace CompiledAssets {
+
+    /// Version stamped into every blob, bump when a record layout changes
+    constexpr std::uint16_t FormatVersion = 1;
+
+    /// Maximum number of attack patterns a boss can list
+    constexpr std::size_t MaxBossPatterns = 12;
+
+    /// Maximum length (including terminator) of a boss name
+    constexpr std::size_t MaxBossNameLength = 64;
+
+    /// Maximum length (including terminator) of a texture path
+    constexpr std::size_t MaxTexturePathLength = 128;
+
+    /**
+     * @brief Boss configuration parsed from a boss file
+     */
+    struct BossDefinition {
+        BossID id = BossID::Boss1;          ///< Boss identifier
+        std::string name = "Unnamed Boss";  ///< Display name
+        int hp = 10;                        ///< Starting (and maximum) hit points
+        std::vector<PatternType> patterns;  ///< Attack patterns in firing order
+        std::string texturePath;            ///< Path to the boss texture
+    };
+
+    /**
+     * @brief Dialogue script parsed from a dialogue file
+     */
+    struct DialogueScript {
+        std::string backgroundPath;      ///< Optional background image path
+        std::vector<std::string> lines;  ///< Dialogue lines in display order
+    };
+
+    /// Called with each dialogue line as soon as it is loaded
+    using LineCallback = std::function<void(const std::string& line)>;
+
+    /**
+     * @brief Fixed-size on-disk record for a compiled boss file
+     * @details Layout is native little-endian with no padding; the whole record is read at once.
+     */
+    struct BossRecord {
+        char magic[4];                           ///< "OBBS"
+        std::uint16_t version;                   ///< FormatVersion
+        std::uint8_t id;                         ///< BossID value
+        std::uint8_t patternCount;               ///< Number of valid entries in patterns
+        std::int32_t hp;                         ///< Hit points
+        std::uint8_t patterns[MaxBossPatterns];  ///< PatternType values
+        char name[MaxBossNameLength];            ///< NUL-terminated name
+        char texture[MaxTexturePathLength];      ///< NUL-terminated texture path
+    };
+    static_assert(sizeof(BossRecord) == 216, "BossRecord layout must stay packed");
+
+    /**
+     * @brief Header of a compiled dialogue file
+     * @details Followed by (lineCount + 1) uint32 offsets into a string pool of poolSize bytes.
+     * Offset 0 is the background path, offsets 1..lineCount are the lines, all NUL-terminated.
+     */
+    struct DialogueHeader {
+        char magic[4];              ///< "OBDL"
+        std::uint16_t version;      ///< FormatVersion
+        std::uint16_t lineCount;    ///< Number of dialogue lines
+        std::uint32_t poolSize;     ///< Size of the string pool in bytes
+    };
+    static_assert(sizeof(DialogueHeader) == 12, "DialogueHeader layout must stay packed");
+
+    /**
+     * @brief Get the compiled blob path for a text asset
+     * @param textPath Path to the text file (EX: "Assets/Boss1.txt")
+     * @return Path of the blob (EX: "Assets/Boss1.bin")
+     */
+    std::string compiledPath(const std::string& textPath);
+
+    /**
+     * @brief Parse and validate a boss text file
+     * @param filePath Path to the boss text file
+     * @param out Definition filled with every value that could be parsed
+     * @param errors Receives one "file:line: message" entry per problem found
+     * @return True if the file is valid
+     */
+    bool parseBossText(const std::string& filePath, BossDefinition& out, std::vector<std::string>& errors);
+
+    /**
+     * @brief Parse and validate a dialogue text file
+     * @param filePath Path to the dialogue text file
+     * @param out Script filled with every value that could be parsed
+     * @param errors Receives one "file:line: message" entry per problem found
+     * @param onLine Optional, called with each line as soon as it is parsed
+     * @return True if the file is valid
+     */
+    bool parseDialogueText(const std::string& filePath, DialogueScript& out, std::vector<std::string>& errors,
+                           const LineCallback& onLine = nullptr);
+
+    /**
+     * @brief Write a compiled boss blob
+     * @param filePath Destination path
+     * @param def Validated definition
+     * @return True on success
+     */
+    bool writeBossBinary(const std::string& filePath, const BossDefinition& def);
+
+    /**
+     * @brief Write a compiled dialogue blob
+     * @param filePath Destination path
+     * @param script Validated script
+     * @return True on success
+     */
+    bool writeDialogueBinary(const std::string& filePath, const DialogueScript& script);
+
+    /**
+     * @brief Read a compiled boss blob with a single read
+     * @param filePath Path to the blob
+     * @param out Definition to fill
+     * @return True if the blob exists and is valid
+     */
+    bool readBossBinary(const std::string& filePath, BossDefinition& out);
+
+    /**
+     * @brief Read a compiled dialogue blob with a single read
+     * @param filePath Path to the blob
+     * @param out Script to fill
+     * @return True if the blob exists and is valid
+     */
+    bool readDialogueBinary(const std::string& filePath, DialogueScript& out);
+
+    /**
+     * @brief Load a boss definition for the runtime
+     * @details Uses the compiled blob if present. Dev builds (NDEBUG not defined) parse the text
+     * file instead when the blob is missing, invalid or older than the text file, and report
+     * any validation errors to std::cerr.
+     * @param textPath Path to the boss text file
+     * @param out Definition to fill
+     * @return True if a definition was loaded
+     */
+    bool loadBoss(const std::string& textPath, BossDefinition& out);
+
+    /**
+     * @brief Load a dialogue script for the runtime
+     * @details Same lookup order as loadBoss().
+     * @param textPath Path to the dialogue text file
+     * @param out Script to fill
+     * @param onLine Optional, called with each line as soon as it is loaded
+     * @return True if a script was loaded
+     */
+    bool loadDialogue(const std::string& textPath, DialogueScript& out, const LineCallback& onLine = nullptr);
+}
+
+#endif // COMPILEDASSETS_HPP
@@ -62,13 +62,17 @@ struct Component {
 
     /**
      * @brief Get the owner entity of this component
-     * @return Shared pointer to the owning GameEntity
+     * @return Shared pointer to the owning GameEntity, nullptr once the owner is destroyed
      */
     std::shared_ptr<GameEntity> GetGameEntity() {
-        return mOwner;
+        return mOwner.lock();
     }
 
 private:
-    /// Pointer to the owner entity
-    std::shared_ptr<GameEntity> mOwner;
+    /**
+     * @brief Pointer to the owner entity
+     * @details Weak, so entity and components do not keep each other alive,
+     * destroying an entity frees its components back to the scene arena
+     */
+    std::weak_ptr<GameEntity> mOwner;
 };
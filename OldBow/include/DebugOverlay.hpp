@@ -0,0 +1,130 @@
+/**
+ * @file DebugOverlay.hpp
+ * @brief DebugOverlay class definition
+ * @details Declares the in-game performance overlay that shows frame time percentiles,
+ * the update / render / present breakdown, live entity counts and draw calls.
+ */
+
+#ifndef DEBUGOVERLAY_HPP
+#define DEBUGOVERLAY_HPP
+
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include "FramePacer.hpp"
+#include "GlyphAtlas.hpp"
+
+/// Live entity counts of the current scene
+struct SceneEntityCounts {
+    int enemies = 0;             ///< Enemies still alive (bosses excluded)
+    int bosses = 0;              ///< Bosses still alive
+    int playerProjectiles = 0;   ///< Projectiles owned by the player
+    int enemyProjectiles = 0;    ///< Projectiles owned by enemies
+    int bossProjectiles = 0;     ///< Projectiles owned by bosses
+    int globalProjectiles = 0;   ///< Projectiles left behind by dead enemies and bosses
+    int culled = 0;              ///< Live entities skipped by the last render for being off-screen
+    unsigned int retired = 0;    ///< Projectiles retired for leaving the play field since the scene started
+    int particles = 0;           ///< Live particles of every effect
+};
+
+/// Timing of one frame, split by stage
+struct FrameTiming {
+    double frameMs = 0.0;    ///< Whole frame, including the pacing wait
+    double updateMs = 0.0;   ///< Input and simulation
+    double renderMs = 0.0;   ///< Building the frame on the renderer
+    double presentMs = 0.0;  ///< SDL_RenderPresent
+    unsigned int drawCalls = 0;
+    float renderScale = 1.0f;  ///< Resolution of the scene relative to the play field
+};
+
+/**
+ * @brief Performance overlay toggled in game (F3)
+ * @details Frame times go into a histogram that is summarized and cleared every second,
+ * so the percentiles describe the last second only. The text is rebuilt four times a second
+ * into a cached vertex list; every other frame the overlay is one fill and one
+ * SDL_RenderGeometry call with the glyph atlas.
+ */
+class DebugOverlay {
+public:
+
+    /**
+     * @brief Show or hide the overlay
+     */
+    void toggle() { mVisible = !mVisible; mDirty = true; }
+
+    /**
+     * @brief Check if the overlay is shown
+     */
+    bool isVisible() const { return mVisible; }
+
+    /**
+     * @brief Record the timing of a finished frame
+     * @param timing Stage timings and draw calls of the frame
+     */
+    void recordFrame(const FrameTiming& timing);
+
+    /**
+     * @brief Draw the overlay in the top left corner
+     * @details Builds the glyph atlas the first time the overlay is shown
+     * @param renderer SDL renderer
+     * @param counts Live entity counts of the current scene
+     * @param fireLatency Average input-to-fire latency in milliseconds, negative if unknown
+     */
+    void render(SDL_Renderer* renderer, const SceneEntityCounts& counts, float fireLatency);
+
+    /**
+     * @brief Release renderer resources, call before the renderer is destroyed
+     */
+    void shutDown() { mAtlas.release(); }
+
+private:
+    /// True when the overlay is drawn
+    bool mVisible = false;
+
+    /// True when the cached text has to be rebuilt
+    bool mDirty = true;
+
+    /// Glyphs used to draw the overlay text
+    GlyphAtlas mAtlas;
+
+    /// True once building the atlas has been attempted
+    bool mAtlasBuilt = false;
+
+    /// Frame times of the current one second window
+    FrameTimeHistogram mWindow;
+
+    /// Time (SDL ticks) at which the current window started
+    Uint32 mWindowStart = 0;
+
+    /// Percentiles of the last complete window
+    double mP50 = 0.0, mP95 = 0.0, mP99 = 0.0;
+
+    /// Stage timings averaged over the last complete window
+    double mUpdateMs = 0.0, mRenderMs = 0.0, mPresentMs = 0.0;
+
+    /// Stage timing sums of the current window
+    double mUpdateSum = 0.0, mRenderSum = 0.0, mPresentSum = 0.0;
+
+    /// Draw calls of the last recorded frame
+    unsigned int mDrawCalls = 0;
+
+    /// Scene resolution scale of the last recorded frame
+    float mRenderScale = 1.0f;
+
+    /// Time (SDL ticks) at which the text was last rebuilt
+    Uint32 mLastRebuild = 0;
+
+    /// Cached text geometry
+    std::vector<SDL_Vertex> mVertices;
+    std::vector<int> mIndices;
+
+    /// Size of the box behind the text
+    SDL_Rect mPanel = { 10, 10, 0, 0 };
+
+    /**
+     * @brief Lay the overlay text out into the cached vertex list
+     */
+    void rebuild(const SceneEntityCounts& counts, float fireLatency);
+};
+
+#endif // DEBUGOVERLAY_HPP
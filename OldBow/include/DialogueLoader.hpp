@@ -0,0 +1,98 @@
+/**
+ * @file DialogueLoader.hpp
+ * @brief DialogueLoader class definition
+ * @details Declares the background loader that parses dialogue scripts and reads their
+ * background images off the main thread.
+ */
+
+#ifndef DIALOGUELOADER_HPP
+#define DIALOGUELOADER_HPP
+
+#include <SDL.h>
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Loads dialogue scripts on a worker thread
+ * @details Every requested script is parsed once (compiled blob or text file) and kept, so
+ * scripts prefetched at scene start are ready before they are needed. Lines are published as
+ * they are parsed, the first ones can be shown while the rest of a long script is still read. Background images are
+ * decoded into surfaces on the worker; turning them into textures is left to the render thread.
+ * All public methods are called from the main thread.
+ */
+class DialogueLoader {
+public:
+
+    /**
+     * @brief Destructor, stops the worker thread
+     */
+    ~DialogueLoader() { shutDown(); }
+
+    /**
+     * @brief Queue a script for loading
+     * @details Does nothing if the script was already requested
+     * @param filePath Path to the dialogue text file
+     */
+    void request(const std::string& filePath);
+
+    /**
+     * @brief Copy the lines of a script that arrived since the last call
+     * @param filePath Path to the dialogue text file
+     * @param lines Lines already received, new lines are appended
+     * @param backgroundPath Set to the script's background path once known
+     * @return True once every line of the script has arrived (or loading failed)
+     */
+    bool stream(const std::string& filePath, std::vector<std::string>& lines, std::string& backgroundPath);
+
+    /**
+     * @brief Take one decoded background image, if any is waiting
+     * @param path Set to the image path
+     * @return Surface now owned by the caller, nullptr if none is waiting
+     */
+    SDL_Surface* takeBackground(std::string& path);
+
+    /**
+     * @brief Stop the worker thread and free every surface still waiting
+     * @details Call before SDL_Quit
+     */
+    void shutDown();
+
+private:
+    /// State of one requested script
+    struct Entry {
+        std::vector<std::string> lines;  ///< Lines received so far
+        std::string backgroundPath;      ///< Background image path, empty if none
+        bool complete = false;           ///< True once loading finished
+    };
+
+    /// Worker thread, started by the first request
+    SDL_Thread* mThread = nullptr;
+
+    /// Guards every member below
+    SDL_mutex* mMutex = nullptr;
+
+    /// Signalled when a script is queued or the worker has to stop
+    SDL_cond* mWork = nullptr;
+
+    /// True when the worker has to exit
+    bool mStopping = false;
+
+    /// Scripts waiting to be loaded
+    std::deque<std::string> mQueue;
+
+    /// Every requested script by path
+    std::map<std::string, Entry> mEntries;
+
+    /// Decoded background images waiting for the render thread
+    std::vector<std::pair<std::string, SDL_Surface*>> mBackgrounds;
+
+    /**
+     * @brief Worker thread body: load queued scripts until asked to stop
+     */
+    static int run(void* data);
+};
+
+#endif // DIALOGUELOADER_HPP
@@ -14,6 +14,7 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include "DialogueLoader.hpp"
 
 
 /**
@@ -25,7 +26,8 @@ class DialogueManager {
 public:
     /**
      * @brief Load dialogue script from file
-     * @details Parses a text file containing dialogue lines and background image information.
+     * @details Starts the dialogue right away; the script is parsed by the background loader and
+     * its lines are streamed in by update(). A prefetched script is available immediately.
      * @param filePath Path to the dialogue text file
      * @param onFinish Callback executed after the entire dialogue sequence is completed
      * @param renderer SDL renderer used to load background texture
@@ -42,16 +44,38 @@ public:
 
     /**
      * @brief Update dialogue manager state
-     * @note Currently placeholder. Reserved for future expansion (e.g., animations, timing).
+     * @details Turns one decoded background image into a texture and pulls the lines of the
+     * current script that arrived from the loader. Call once per frame on the render thread.
      */
     void update();
 
+    /**
+     * @brief Start loading scripts that may be needed later (EX: the death dialogues)
+     * @details Scripts are parsed and their backgrounds decoded in the background,
+     * so entering one of these dialogues later never stalls a frame
+     * @param filePaths Paths to the dialogue text files
+     * @param renderer SDL renderer used to create the background textures
+     */
+    void prefetch(const std::vector<std::string>& filePaths, SDL_Renderer* renderer);
+
+    /**
+     * @brief Stop the background loader, call before SDL_Quit
+     */
+    void shutDown() { mLoader.shutDown(); currentBackground = nullptr; }
+
     /**
      * @brief Check if the dialogue sequence has finished
      * @return True if dialogue is complete, false otherwise
      */
     bool isFinished();
 
+    /**
+     * @brief Check if the current dialogue is still loading
+     * @details True until every line has arrived and the script's background is shown,
+     * the screen can still change without any input until then
+     */
+    bool isLoading() const { return mIsActive && !(mStreamComplete && mBackgroundShown); }
+
     /**
      * @brief Get the current background texture
      * @return Shared pointer to SDL_Texture for current background image
@@ -97,6 +121,29 @@ private:
      * @brief Background texture displayed during the dialogue sequence
      */
     std::shared_ptr<SDL_Texture> currentBackground = nullptr;;
+
+    /// Parses scripts and decodes backgrounds off the main thread
+    DialogueLoader mLoader;
+
+    /// Renderer used to create background textures
+    SDL_Renderer* mRenderer = nullptr;
+
+    /// Script currently shown
+    std::string mScriptPath;
+
+    /// Background image of the current script, empty until known or if it has none
+    std::string mBackgroundPath;
+
+    /// True once every line of the current script has arrived
+    bool mStreamComplete = true;
+
+    /// True once the current script's background (or the lack of one) is shown
+    bool mBackgroundShown = true;
+
+    /**
+     * @brief Pull newly arrived lines and the background of the current script
+     */
+    void pullScript();
 };
 
 
@@ -8,10 +8,12 @@
 #ifndef ENEMY_HPP
 #define ENEMY_HPP
 
-#include "Projectile.hpp"
+#include "ProjectileList.hpp"
 #include "GameEntity.hpp"
+#include "TimerWheel.hpp"
 #include <vector>
 #include <memory>
+#include <random>
 
 /**
  * @brief Represents an enemy entity in the game
@@ -64,17 +66,23 @@ private:
     float minLaunchTime;
 
     /**
-     * @brief Timestamp of the last fired projectile
-     * @details Used to enforce projectile cooldown timing.
+     * @brief Fire one projectile downward
      */
-    Uint64 lastFireTime;
+    void fire();
+
+    /**
+     * @brief Schedule the next shot on the scene's timer wheel
+     * @param timers Timer wheel of the scene
+     * @param delay Delay before the shot (in seconds)
+     */
+    void scheduleShot(TimerWheel& timers, float delay);
 
 protected:
     /**
      * @brief Container for projectiles fired by this enemy
-     * @details Dynamic vector storing active projectiles for update and rendering.
+     * @details One batch per projectile kind, storing active projectiles for update and rendering.
      */
-    std::vector<std::shared_ptr<Projectile>> mProjectiles;
+    ProjectileList mProjectiles;
 
     /**
      * @brief SDL renderer reference
@@ -100,17 +108,19 @@ public:
     virtual void init();
 
     /**
-     * @brief Update enemy state
-     * @details Handles enemy movement logic, projectile firing, and projectile cleanup.
-     * @param deltaTime Time elapsed since last frame (in seconds)
+     * @brief Register the enemy's attacks on the scene's timer wheel
+     * @details Called once by the scene after init(). The first shot is fired as soon as the battle runs,
+     * then one every minLaunchTime. Timers of a dead enemy lapse on their next shot.
+     * @param timers Timer wheel of the scene
      */
-    void update(float deltaTime) override;
+    virtual void startTimers(TimerWheel& timers);
 
     /**
-     * @brief Render the enemy and its projectiles
-     * @param renderer SDL renderer used for drawing textures
+     * @brief Update enemy state
+     * @details Handles enemy movement logic and projectile cleanup, shots are fired by the timer wheel.
+     * @param deltaTime Time elapsed since last frame (in seconds)
      */
-    void render(SDL_Renderer* renderer) override;
+    void update(float deltaTime) override;
 
     /**
      * @brief Set horizontal movement threshold for all enemies
@@ -121,11 +131,28 @@ public:
         movementThreshold = threshold;
     }
 
+    /**
+     * @brief Get the minimum interval between projectile launches
+     * @return Interval in milliseconds
+     */
+    float getFireInterval() const { return minLaunchTime; }
+
+    /**
+     * @brief Set the minimum interval between projectile launches
+     * @param interval Interval in milliseconds
+     */
+    void setFireInterval(float interval) { minLaunchTime = interval; }
+
+    /**
+     * @brief Random engine drawing the enemies' firing intervals, saved and restored by scene checkpoints
+     */
+    static std::mt19937& fireIntervalEngine();
+
     /**
      * @brief Get active projectiles fired by the enemy
-     * @return Reference to the vector of enemy projectiles
+     * @return Reference to the list of enemy projectiles
      */
-    std::vector<std::shared_ptr<Projectile>>& getProjectiles() { return mProjectiles; }
+    ProjectileList& getProjectiles() { return mProjectiles; }
 
     /**
      * @brief Handle enemy being hit by a projectile
@@ -0,0 +1,173 @@
+/**
+ * @file FramePacer.hpp
+ * @brief FramePacer and FrameTimeHistogram class definitions
+ * @details Declares the frame pacer that holds the game loop to an exact frame period
+ * using the high resolution performance counter, plus the histogram it records frame times into.
+ */
+
+#ifndef FRAMEPACER_HPP
+#define FRAMEPACER_HPP
+
+#include <SDL.h>
+#include <array>
+
+/**
+ * @brief Fixed-bucket histogram of frame times
+ * @details 0.1 ms buckets from 0 to 100 ms, anything slower lands in the last bucket.
+ * Adding a sample and querying a percentile never allocate.
+ */
+class FrameTimeHistogram {
+public:
+    /// Width of one bucket in milliseconds
+    static constexpr double BucketWidth = 0.1;
+
+    /// Number of buckets (covers 0 - 100 ms)
+    static constexpr int BucketCount = 1000;
+
+    /**
+     * @brief Record one frame time
+     * @param milliseconds Frame time in milliseconds
+     */
+    void add(double milliseconds);
+
+    /**
+     * @brief Get a percentile of the recorded frame times
+     * @param percentile Value between 0 and 100 (EX: 99 for p99)
+     * @return Frame time in milliseconds (upper edge of the bucket), 0 if empty
+     */
+    double getPercentile(double percentile) const;
+
+    /**
+     * @brief Get the mean of the recorded frame times
+     * @return Mean frame time in milliseconds, 0 if empty
+     */
+    double getMean() const { return mCount ? mTotal / mCount : 0.0; }
+
+    /**
+     * @brief Get the number of recorded frames
+     */
+    unsigned int getCount() const { return mCount; }
+
+    /**
+     * @brief Clear all samples
+     */
+    void reset();
+
+private:
+    /// Number of frames per bucket
+    std::array<unsigned int, BucketCount> mBuckets{};
+
+    /// Number of samples recorded
+    unsigned int mCount = 0;
+
+    /// Sum of all samples in milliseconds
+    double mTotal = 0.0;
+};
+
+/**
+ * @brief Holds the game loop to an exact target frame rate
+ * @details Frames are scheduled against absolute deadlines on SDL_GetPerformanceCounter,
+ * so a 60 FPS target really is 16.67 ms and rounding errors do not accumulate.
+ * Waiting sleeps with clock_nanosleep (SDL_Delay on platforms without it) until shortly
+ * before the deadline, then spin-waits the remaining tail. The tail length adapts to the
+ * measured sleep overshoot. In vsync mode SDL_RenderPresent does the waiting instead.
+ */
+class FramePacer {
+public:
+
+    /**
+     * @brief Constructor, defaults to 60 FPS without vsync
+     */
+    FramePacer();
+
+    /**
+     * @brief Set the target frame rate
+     * @param fps Frames per second (EX: 60, 120, 144)
+     */
+    void setTargetFPS(int fps);
+
+    /**
+     * @brief Enable or disable vsync-aware pacing
+     * @details With vsync on and a target at or above the refresh rate, the pacer never sleeps.
+     * With a lower target, it sleeps to half a refresh interval before the deadline so the
+     * present lands on the intended vblank.
+     * @param enabled True if the renderer presents with vsync
+     * @param refreshRate Display refresh rate in Hz (0 if unknown)
+     */
+    void setVSync(bool enabled, int refreshRate);
+
+    /**
+     * @brief Start pacing from now, call once before the first frame
+     */
+    void start();
+
+    /**
+     * @brief Wait until the next frame deadline and record the frame time
+     * @details Call once per frame, after the frame has been presented
+     */
+    void waitForNextFrame();
+
+    /**
+     * @brief Get the duration of the last complete frame
+     * @return Frame time in milliseconds
+     */
+    double getLastFrameTime() const { return mLastFrameTime; }
+
+    /**
+     * @brief Get the histogram of recorded frame times
+     */
+    const FrameTimeHistogram& getHistogram() const { return mHistogram; }
+
+    /**
+     * @brief Clear the recorded frame time histogram
+     */
+    void resetHistogram() { mHistogram.reset(); }
+
+    /**
+     * @brief Get the target frame period
+     * @return Frame period in milliseconds
+     */
+    double getFramePeriod() const { return mPeriodTicks * 1000.0 / mFrequency; }
+
+private:
+    /// Performance counter ticks per second
+    Uint64 mFrequency;
+
+    /// Target frame period in performance counter ticks
+    Uint64 mPeriodTicks;
+
+    /// Absolute time of the next frame deadline
+    Uint64 mNextDeadline = 0;
+
+    /// Time at which the last frame ended
+    Uint64 mLastFrameEnd = 0;
+
+    /// True if the renderer presents with vsync
+    bool mVSync = false;
+
+    /// Display refresh rate in Hz, 0 if unknown
+    int mRefreshRate = 0;
+
+    /// Estimated sleep overshoot in seconds, the spin-wait tail covers it
+    double mSleepOvershoot = 0.001;
+
+    /// Duration of the last complete frame in milliseconds
+    double mLastFrameTime = 0.0;
+
+    /// Recorded frame times
+    FrameTimeHistogram mHistogram;
+
+    /**
+     * @brief Sleep then spin until the given absolute time
+     * @param deadline Performance counter value to wait for
+     */
+    void waitUntil(Uint64 deadline);
+
+    /**
+     * @brief Sleep for approximately the given duration using the OS high resolution sleep
+     * @param seconds Duration to sleep
+     */
+    void preciseSleep(double seconds);
+};
+
+#endif // FRAMEPACER_HPP
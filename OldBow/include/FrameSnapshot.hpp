@@ -0,0 +1,56 @@
+/**
+ * @file FrameSnapshot.hpp
+ * @brief FrameSnapshot definition
+ * @details Declares the immutable copy of a simulated frame that the main thread renders
+ * while the simulation thread works on the next frame.
+ */
+
+#ifndef FRAMESNAPSHOT_HPP
+#define FRAMESNAPSHOT_HPP
+
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include "GameState.hpp"
+#include "TextureComponent.hpp"
+#include "DebugOverlay.hpp"
+#include "ParticleSystem.hpp"
+
+/**
+ * @brief Everything the renderer needs from one simulated frame
+ * @details Written by the simulation thread at the end of a frame and handed to the main thread
+ * through a TripleBuffer. The renderer reads scene, dialogue and UI state only from here, never
+ * from the globals the simulation writes. Texture pointers stay valid because the ResourceManager
+ * cache and the scene backgrounds outlive every snapshot.
+ */
+struct FrameSnapshot {
+    GameState state = GameState::Dialogue;  ///< Game state at the end of the frame
+    SDL_Texture* background = nullptr;      ///< Battle background, nullptr outside of battle
+    std::vector<SpriteCommand> sprites;     ///< Visible sprites in draw order
+    std::vector<ParticleBatch> particles;   ///< Particles drawn over the sprites, one batch per emitter
+    SceneEntityCounts counts;               ///< Entity counts for the debug overlay
+    float fireLatency = -1.0f;              ///< Average input-to-fire latency in ms, negative if unknown
+    SDL_Texture* dialogueBackground = nullptr;  ///< Background of the loaded dialogue, if any
+    bool showDialogue = false;              ///< True while a dialogue is being read
+    std::string dialogueLine;               ///< Line of the dialogue being read
+    double simulationMs = 0.0;              ///< Time the simulation thread spent on this frame
+
+    /**
+     * @brief Empty the snapshot, keeping the sprite and particle lists' memory
+     */
+    void clear() {
+        background = nullptr;
+        sprites.clear();
+        for (ParticleBatch& batch : particles) {
+            batch.vertices.clear();  ///< Indices are kept, they never change
+        }
+        counts = SceneEntityCounts{};
+        fireLatency = -1.0f;
+        simulationMs = 0.0;
+        dialogueBackground = nullptr;
+        showDialogue = false;
+        dialogueLine.clear();
+    }
+};
+
+#endif // FRAMESNAPSHOT_HPP
@@ -10,10 +10,15 @@
 #include "Component.hpp"
 #include "ComponentType.hpp"
 #include "TransformComponent.hpp"
+#include "TextureComponent.hpp"
+#include "Collision2DComponent.hpp"
+#include "SceneArena.hpp"
 #include <SDL.h>
 #include <memory>
 #include <map>
 
+class InputComponent;
+
 /**
  * @brief Base class for all game entities
  * Shared logic for player, enemies, and other movable game objects
@@ -35,6 +40,19 @@ protected:
     /// True if the entity is active and should be rendered
     bool mRenderable{true};
 
+    /// False if the scene's visibility pass found the entity outside the view this frame
+    bool mOnScreen{true};
+
+    /**
+     * @brief Typed pointers into mComponents, set by AddComponent
+     * @details Hot paths use these instead of a map lookup and dynamic cast per call.
+     * The map keeps the components alive.
+     */
+    TransformComponent* mTransform = nullptr;
+    TextureComponent* mTexture = nullptr;
+    Collision2DComponent* mCollision = nullptr;
+    InputComponent* mInput = nullptr;
+
 
 public:
 
@@ -62,20 +80,6 @@ public:
      */
     virtual void update(float deltaTime);
 
-    /**
-     * @brief Render the entity
-     * @param renderer SDL renderer
-     */
-    virtual void render(SDL_Renderer* renderer);
-
-
-    /**
-     * @brief Check collision with another entity
-     * @param entity Target entity to check against
-     * @return True if collision is detected
-     */
-    bool TestCollision(std::shared_ptr<GameEntity> entity);
-
     /**
      * @brief Set entity render state
      * @param value True to render, false to hide
@@ -88,6 +92,18 @@ public:
      */
     bool getRenderable() const { return mRenderable; }
 
+    /**
+     * @brief Set whether the entity is inside the view, used to skip drawing off-screen sprites
+     * @param value True if any part of the entity is visible
+     */
+    void setOnScreen(bool value) { mOnScreen = value; }
+
+    /**
+     * @brief Check if the entity was inside the view at the last visibility pass
+     * @return True if it should be drawn
+     */
+    bool isOnScreen() const { return mOnScreen; }
+
     /**
      * @brief Add a component to the entity
      * @tparam T Component type
@@ -114,10 +130,49 @@ public:
 
     /**
      * @brief Get the TransformComponent of this entity
-     * @return Shared pointer to TransformComponent
+     * @return Pointer to TransformComponent, nullptr if none was added
+     */
+    TransformComponent* GetTransform() const { return mTransform; }
+
+    /**
+     * @brief Get the Collision2DComponent of this entity
+     * @return Pointer to Collision2DComponent, nullptr if none was added
+     */
+    Collision2DComponent* GetCollision() const { return mCollision; }
+
+    /**
+     * @brief Move the hitbox to the current transform
+     * @details Non-virtual, called by the scene's collision pass for every entity
+     */
+    void syncCollider() {
+        if (mCollision && mTransform) {
+            mCollision -> sync(*mTransform);
+        }
+    }
+
+    /**
+     * @brief Place the entity at a position without sweeping its hitbox there
+     * @details Use for spawns, relaunches and checkpoint restores instead of moving the transform
+     * @param x New position X
+     * @param y New position Y
+     */
+    void teleport(float x, float y) {
+        if (mTransform) {
+            mTransform -> move(x, y);
+        }
+        if (mCollision) {
+            mCollision -> resetSweep();
+        }
+    }
+
+    /**
+     * @brief Record the entity's texture draw into a frame snapshot
+     * @param sprites Sprite list of the snapshot
      */
-    std::shared_ptr<TransformComponent> GetTransform() {
-        return GetComponent<TransformComponent>(ComponentType::TransformComponent);
+    void recordSprite(std::vector<SpriteCommand>& sprites) const {
+        if (mTexture && mTransform) {
+            mTexture -> record(sprites, *mTransform);
+        }
     }
 
     /**
@@ -125,10 +180,17 @@ public:
      * Create and add a new TransformComponent to this entity
      */
     void AddDefaultTransform() {
-        auto transform = std::make_shared<TransformComponent>();
+        auto transform = SceneArena::makeShared<TransformComponent>();
         AddComponent(transform);
     }
 
+private:
+    /// Remember the typed pointer of a newly added component
+    void cacheComponent(TransformComponent* component) { mTransform = component; }
+    void cacheComponent(TextureComponent* component) { mTexture = component; }
+    void cacheComponent(Collision2DComponent* component) { mCollision = component; }
+    void cacheComponent(InputComponent* component) { mInput = component; }
+
 };
 
 #endif // GAMEENTITY_HPP
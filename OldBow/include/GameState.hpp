@@ -0,0 +1,22 @@
+/**
+ * @file GameState.hpp
+ * @brief GameState enum definition
+ * @details Kept on its own so frame snapshots can carry the state without including the Application.
+ */
+
+#ifndef GAMESTATE_HPP
+#define GAMESTATE_HPP
+
+/// GameState enum controls overall game flow
+enum class GameState {
+    /// Player is currently in reading plot
+    Dialogue,
+    /// Player is currently in battle stage
+    Playing,
+    /// Player has been defeated
+    Defeat,
+    /// Player has cleared all stages
+    Victory
+};
+
+#endif // GAMESTATE_HPP
@@ -0,0 +1,168 @@
+/**
+ * @file GlyphAtlas.hpp
+ * @brief GlyphAtlas class definition
+ * @details Declares a texture atlas of pre-rasterized glyphs for one font and size,
+ * used to draw text as batched quads without creating surfaces or textures per frame.
+ */
+
+#ifndef GLYPHATLAS_HPP
+#define GLYPHATLAS_HPP
+
+#include <SDL.h>
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Pre-rasterized printable ASCII glyphs packed into one texture
+ * @details Built once per font/size. Text is appended as quads into a vertex list,
+ * and a whole list is drawn with a single SDL_RenderGeometry call.
+ * Text is UTF-8: typographic dashes and quotes are drawn with their ASCII look-alikes,
+ * any other character outside printable ASCII is drawn as '?'.
+ */
+class GlyphAtlas {
+public:
+
+    /**
+     * @brief Constructor, the atlas is empty until build() is called
+     */
+    GlyphAtlas() = default;
+
+    /**
+     * @brief Destructor, releases the atlas texture
+     */
+    ~GlyphAtlas();
+
+    /// The atlas owns a texture, so it cannot be copied
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    /**
+     * @brief Rasterize every glyph and upload the atlas texture
+     * @param renderer SDL renderer that will draw the text
+     * @param fontPath Path to the TTF font
+     * @param pointSize Font size in points
+     * @return True if the atlas is ready to draw
+     */
+    bool build(SDL_Renderer* renderer, const std::string& fontPath, int pointSize);
+
+    /**
+     * @brief Rasterize every glyph into the atlas image, without creating the texture
+     * @details Does not touch the renderer, so it can run on a worker thread (EX: while the window is created)
+     * @param fontPath Path to the TTF font
+     * @param pointSize Font size in points
+     * @return True if the atlas image is ready to upload
+     */
+    bool rasterize(const std::string& fontPath, int pointSize);
+
+    /**
+     * @brief Turn the image from rasterize() into the atlas texture, render thread only
+     * @param renderer SDL renderer that will draw the text
+     * @return True if the atlas is ready to draw
+     */
+    bool upload(SDL_Renderer* renderer);
+
+    /**
+     * @brief Release the atlas texture
+     * @details Must be called before the renderer is destroyed
+     */
+    void release();
+
+    /**
+     * @brief Check if the atlas has been built
+     */
+    bool isReady() const { return mTexture != nullptr; }
+
+    /**
+     * @brief Get the height of one line of text
+     * @return Line height in pixels
+     */
+    int getLineHeight() const { return mLineHeight; }
+
+    /**
+     * @brief Measure the width of a string
+     * @param text Text to measure
+     * @return Width in pixels
+     */
+    int measureText(const std::string& text) const;
+
+    /**
+     * @brief Append the quads for a string to a vertex list
+     * @param vertices Vertex list to append to (4 vertices per visible glyph)
+     * @param indices Index list to append to (6 indices per visible glyph)
+     * @param text Text to lay out on one line
+     * @param x Left edge of the text
+     * @param y Top edge of the text
+     * @param color Text color
+     */
+    void appendText(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices,
+                    const std::string& text, float x, float y, SDL_Color color) const;
+
+    /**
+     * @brief Split text into lines that fit a given width
+     * @details Breaks at spaces; a single word wider than the limit gets a line of its own
+     * @param text Text to wrap
+     * @param maxWidth Maximum line width in pixels
+     * @return Wrapped lines
+     */
+    std::vector<std::string> wrapText(const std::string& text, int maxWidth) const;
+
+    /**
+     * @brief Append word wrapped text to a vertex list
+     * @param vertices Vertex list to append to
+     * @param indices Index list to append to
+     * @param text Text to lay out
+     * @param x Left edge of the text
+     * @param y Top edge of the first line
+     * @param maxWidth Maximum line width in pixels
+     * @param color Text color
+     * @return Number of lines used
+     */
+    int appendWrappedText(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices,
+                          const std::string& text, float x, float y, int maxWidth, SDL_Color color) const;
+
+    /**
+     * @brief Draw a prepared vertex list with one draw call
+     * @param renderer SDL renderer
+     * @param vertices Vertices built by appendText()
+     * @param indices Indices built by appendText()
+     */
+    void draw(SDL_Renderer* renderer, const std::vector<SDL_Vertex>& vertices, const std::vector<int>& indices) const;
+
+private:
+    /// Location and advance of one glyph in the atlas
+    struct Glyph {
+        SDL_Rect source{0, 0, 0, 0};  ///< Glyph cell in the atlas texture
+        int advance = 0;              ///< Horizontal pen advance in pixels
+    };
+
+    /// First and last character stored in the atlas
+    static constexpr int FirstChar = 32;
+    static constexpr int LastChar = 126;
+
+    /// Glyphs for every printable ASCII character
+    std::array<Glyph, LastChar - FirstChar + 1> mGlyphs;
+
+    /// Atlas texture
+    SDL_Texture* mTexture = nullptr;
+
+    /// Atlas image rasterized but not uploaded yet
+    SDL_Surface* mImage = nullptr;
+
+    /// Atlas texture size, used to normalize texture coordinates
+    int mTextureWidth = 0;
+    int mTextureHeight = 0;
+
+    /// Height of one line of text
+    int mLineHeight = 0;
+
+    /**
+     * @brief Decode the next UTF-8 character and get its glyph
+     * @param text Text being laid out
+     * @param index Byte position of the character, advanced past it
+     * @return Glyph to draw, '?' for anything unsupported
+     */
+    const Glyph& nextGlyph(const std::string& text, size_t& index) const;
+};
+
+#endif // GLYPHATLAS_HPP
@@ -17,8 +17,10 @@ class Player;
 
 /**
  * @brief Component for handling player input
+ * @details Replays the timestamped keyboard events queued in InputQueue,
+ * so movement and firing happen at the sub-step where the key actually changed.
  */
-class InputComponent : public Component {
+class InputComponent final : public Component {
 
 public:
     // Public member variable
@@ -32,6 +34,8 @@ public:
 
     /**
      * @brief Handle player input
+     * @details Moves the player segment by segment between queued key events,
+     * and fires once for every spacebar press in the frame.
      * @param deltaTime Time elapsed since last frame
      */
     void input(float deltaTime) override;
@@ -58,12 +62,22 @@ private:
     /// Player movement speed
     float mSpeed;
 
-    /// Track if spacebar is currently pressed
-    bool spacebarPressed{false};
-
     /// SDL renderer for creating textures
     SDL_Renderer* mRenderer;
 
+    /// Minimum time between two arrows in milliseconds
+    static constexpr Uint32 FireInterval = 1000;
+
+    /// Time of the last arrow fired
+    Uint64 mLastFireTime = 0;
+
+    /**
+     * @brief Fire a projectile from the player's current position
+     * @param subStepOffset Seconds into the frame at which the key was pressed
+     * @param pressTime SDL timestamp of the key press, used for latency tracking
+     */
+    void fire(float subStepOffset, Uint32 pressTime);
+
 };
 
 #endif // INPUTCOMPONENT_HPP
@@ -0,0 +1,112 @@
+/**
+ * @file InputQueue.hpp
+ * @brief InputQueue class definition
+ * @details Declares the per-frame queue of timestamped keyboard events that replaces
+ * polling SDL_GetKeyboardState once per frame.
+ */
+
+#ifndef INPUTQUEUE_HPP
+#define INPUTQUEUE_HPP
+
+#include <SDL.h>
+#include <array>
+#include <vector>
+
+/**
+ * @brief One keyboard transition captured from the SDL event queue
+ */
+struct InputEvent {
+    /// Physical key that changed state
+    SDL_Scancode scancode;
+
+    /// True for SDL_KEYDOWN, false for SDL_KEYUP
+    bool pressed;
+
+    /// SDL timestamp of the event in milliseconds
+    Uint32 timestamp;
+};
+
+/**
+ * @brief Collects keyboard events between two frames
+ * @details Application pushes every SDL_KEYDOWN / SDL_KEYUP event with its timestamp,
+ * then the simulation replays them in order so a press and release inside one frame is never lost.
+ * Also tracks the measured input-to-fire latency.
+ */
+class InputQueue {
+public:
+
+    /**
+     * @brief Start collecting a new frame of events
+     * @details Snapshots the key state at the start of the frame and clears the previous events
+     * @param frameTime Time (SDL ticks) at which the frame's input is sampled
+     */
+    void beginFrame(Uint32 frameTime);
+
+    /**
+     * @brief Queue a keyboard event
+     * @details Key repeat events are ignored, only real transitions are queued
+     * @param key Keyboard event from SDL_PollEvent
+     */
+    void push(const SDL_KeyboardEvent& key);
+
+    /**
+     * @brief Get the events queued this frame, in arrival order
+     * @return Reference to the event vector
+     */
+    const std::vector<InputEvent>& getEvents() const { return mEvents; }
+
+    /**
+     * @brief Check if a key was held when the frame started
+     * @param scancode Key to check
+     * @return True if the key was down before any event of this frame
+     */
+    bool wasHeldAtFrameStart(SDL_Scancode scancode) const { return mHeldAtFrameStart[scancode]; }
+
+    /**
+     * @brief Get the time at which this frame's input was sampled
+     * @return SDL ticks in milliseconds
+     */
+    Uint32 getFrameTime() const { return mFrameTime; }
+
+    /**
+     * @brief Record the latency between a fire key press and the projectile launch
+     * @param milliseconds Measured latency
+     */
+    void recordFireLatency(float milliseconds);
+
+    /**
+     * @brief Get the most recent input-to-fire latency
+     * @return Latency in milliseconds
+     */
+    float getLastFireLatency() const { return mLastFireLatency; }
+
+    /**
+     * @brief Get the smoothed input-to-fire latency
+     * @return Exponential moving average in milliseconds
+     */
+    float getAverageFireLatency() const { return mAverageFireLatency; }
+
+private:
+    /// Events queued since the frame started
+    std::vector<InputEvent> mEvents;
+
+    /// Current state of every key, updated as events are pushed
+    std::array<bool, SDL_NUM_SCANCODES> mHeld{};
+
+    /// State of every key when the frame started
+    std::array<bool, SDL_NUM_SCANCODES> mHeldAtFrameStart{};
+
+    /// Time at which this frame's input was sampled
+    Uint32 mFrameTime = 0;
+
+    /// Most recent input-to-fire latency (milliseconds)
+    float mLastFireLatency = 0.0f;
+
+    /// Smoothed input-to-fire latency (milliseconds), negative until the first sample
+    float mAverageFireLatency = -1.0f;
+};
+
+/// Global input queue shared by Application (producer) and InputComponent (consumer)
+extern InputQueue inputQueue;
+
+#endif // INPUTQUEUE_HPP
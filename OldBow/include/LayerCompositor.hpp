@@ -0,0 +1,128 @@
+/**
+ * @file LayerCompositor.hpp
+ * @brief LayerCompositor class definition
+ * @details Declares the compositor that keeps the static background layer and the gameplay
+ * layer in render targets, so a frame redraws only what moved.
+ */
+
+#ifndef LAYERCOMPOSITOR_HPP
+#define LAYERCOMPOSITOR_HPP
+
+#include <SDL.h>
+#include <vector>
+
+struct FrameSnapshot;
+
+/**
+ * @brief Composites the background and gameplay layers of a frame onto the window
+ * @details The background layer (dialogue background under the battle background) is drawn
+ * once into a cached target and only redrawn when its textures or the resolution change.
+ * Layers hidden under an opaque layer are skipped.
+ * The gameplay layer target keeps the previous frame: the tiles covered by the previous
+ * frame's sprites and particles are restored from the background layer, then the new ones are drawn.
+ * Only the final upscale to the window touches the whole screen, once per frame.
+ * Both targets are drawn at the resolution scale in their top left corner (see RenderScaler).
+ * The UI layer (dialogue box, text, overlay) is drawn by the application on top, at window resolution.
+ * Without render target support the frame is drawn straight to the window.
+ */
+class LayerCompositor {
+public:
+    /**
+     * @brief Create the layer targets
+     * @param renderer SDL renderer
+     * @param logicalWidth Width of the play field in logical coordinates
+     * @param logicalHeight Height of the play field in logical coordinates
+     * @return True if layers are cached in render targets
+     */
+    bool init(SDL_Renderer* renderer, int logicalWidth, int logicalHeight);
+
+    /**
+     * @brief Bring the layers up to date with a frame and put them on the window
+     * @param renderer SDL renderer
+     * @param frame Snapshot of the frame to draw
+     * @param scale Resolution scale of the layers (1 is the full logical resolution)
+     */
+    void composite(SDL_Renderer* renderer, const FrameSnapshot& frame, float scale);
+
+    /**
+     * @brief Drop the cached layers, they are redrawn in full by the next frame
+     * @details Call when a scene changes or the renderer lost its target contents
+     */
+    void invalidate() { mBackgroundValid = false; mGameplayValid = false; }
+
+    /**
+     * @brief Check if the layers can be drawn at a reduced resolution
+     */
+    bool isScalable() const { return mGameplay != nullptr; }
+
+    /**
+     * @brief Get the resolution scale of the last composited frame
+     */
+    float getScale() const { return mScale; }
+
+    /**
+     * @brief Release the targets, call before the renderer is destroyed
+     */
+    void shutDown();
+
+private:
+    /// Cached background layer
+    SDL_Texture* mBackground = nullptr;
+
+    /// Gameplay layer: background plus the sprites of the last frame
+    SDL_Texture* mGameplay = nullptr;
+
+    /// Logical play field size
+    int mLogicalWidth = 0;
+    int mLogicalHeight = 0;
+
+    /// Resolution scale the layers are drawn at
+    float mScale = 1.0f;
+
+    /// Part of the targets in use at the current scale, in target pixels
+    SDL_Rect mUsed = { 0, 0, 0, 0 };
+
+    /// Textures the background layer was drawn from
+    SDL_Texture* mDialogueBackground = nullptr;
+    SDL_Texture* mBattleBackground = nullptr;
+
+    /// True while the cached layers match their sources
+    bool mBackgroundValid = false;
+    bool mGameplayValid = false;
+
+    /// Size of a dirty tile in target pixels
+    static constexpr int TileSize = 32;
+
+    /// Tiles of the gameplay layer covered by the last frame's sprites and particles, row by row
+    std::vector<Uint8> mDirtyTiles;
+    int mTileColumns = 0;
+    int mTileRows = 0;
+    int mDirtyTileCount = 0;
+
+    /**
+     * @brief Draw the visible background textures of a frame, skipping those under an opaque one
+     */
+    void drawBackground(SDL_Renderer* renderer, const FrameSnapshot& frame, bool toWindow);
+
+    /**
+     * @brief Set the resolution scale and the part of the targets it uses
+     */
+    void setScale(float scale);
+
+    /**
+     * @brief Restore the tiles under the previous frame's sprites and particles from the background layer
+     */
+    void restoreDirty(SDL_Renderer* renderer);
+
+    /**
+     * @brief Mark the tiles covered by a sprite as dirty
+     */
+    void markDirty(const SDL_FRect& rect, double rotation);
+
+    /**
+     * @brief Mark the tiles under an area (logical coordinates) as dirty
+     */
+    void markArea(float left, float top, float right, float bottom);
+};
+
+#endif // LAYERCOMPOSITOR_HPP
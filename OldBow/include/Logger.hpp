@@ -0,0 +1,90 @@
+/**
+ * @file Logger.hpp
+ * @brief Logger class definition and logging macros
+ * @details Declares the asynchronous logger: any thread formats a message into a lock-free
+ * ring buffer and a background thread writes it to stderr, so logging never blocks a frame.
+ * Every call site is rate limited on its own, a bad asset path reported each frame
+ * prints a few lines per second and a count of the ones suppressed.
+ */
+
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <SDL.h>
+#include <atomic>
+
+/// Severity of a message, messages below the logger's level are dropped
+enum class LogLevel {
+    Debug,
+    Info,
+    Warning,
+    Error
+};
+
+/**
+ * @brief Rate limiting state of one log call site
+ * @details Declared static by the LOG_ macros, one per call site. Plain atomics, so it is
+ * constant initialized and costs no guard on the calling thread.
+ */
+struct LogSite {
+    const char* file;
+    int line;
+    std::atomic<Uint32> windowStart{0};  ///< Start of the current rate window (SDL ticks)
+    std::atomic<Uint32> inWindow{0};     ///< Messages attempted in the current window
+    std::atomic<Uint32> suppressed{0};   ///< Messages dropped since the last one written
+};
+
+/**
+ * @brief Asynchronous, rate limited logger
+ * @details Producers never lock or wait: a message is formatted into a fixed-size slot of a
+ * bounded multi-producer ring buffer. When the buffer is full the message is dropped and
+ * counted, the flush thread reports how many were lost.
+ * Before start() and after shutDown() messages are written directly to stderr.
+ * @example
+ * LOG_ERROR("Could not load boss file: %s", filePath.c_str());
+ */
+class Logger {
+public:
+    /// Messages written per call site and rate window, the rest are suppressed
+    static constexpr Uint32 MaxPerWindow = 5;
+
+    /// Length of a rate window in milliseconds
+    static constexpr Uint32 RateWindowMs = 1000;
+
+    /**
+     * @brief Start the flush thread, call first thing in main()
+     */
+    static void start();
+
+    /**
+     * @brief Write every queued message and stop the flush thread
+     */
+    static void shutDown();
+
+    /**
+     * @brief Drop messages below a severity
+     * @param level Lowest severity written (default Info)
+     */
+    static void setLevel(LogLevel level);
+
+    /**
+     * @brief Queue a message, use the LOG_ macros instead
+     * @param site Call site the message comes from
+     * @param level Severity
+     * @param format printf-style format
+     */
+    static void write(LogSite& site, LogLevel level, SDL_PRINTF_FORMAT_STRING const char* format, ...) SDL_PRINTF_VARARG_FUNC(3);
+};
+
+/// Log from this call site at a given severity
+#define LOG_AT(level, ...) do { \
+    static LogSite logSite{ __FILE__, __LINE__ }; \
+    Logger::write(logSite, level, __VA_ARGS__); \
+} while (0)
+
+#define LOG_DEBUG(...)   LOG_AT(LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(...)    LOG_AT(LogLevel::Info, __VA_ARGS__)
+#define LOG_WARNING(...) LOG_AT(LogLevel::Warning, __VA_ARGS__)
+#define LOG_ERROR(...)   LOG_AT(LogLevel::Error, __VA_ARGS__)
+
+#endif // LOGGER_HPP
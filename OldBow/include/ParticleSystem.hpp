@@ -0,0 +1,163 @@
+/**
+ * @file ParticleSystem.hpp
+ * @brief ParticleSystem class definition
+ * @details Declares the particle effects of a scene (hit sparks, death bursts, projectile trails),
+ * their fixed-capacity struct-of-arrays pools and the batches the renderer draws them from.
+ */
+
+#ifndef PARTICLESYSTEM_HPP
+#define PARTICLESYSTEM_HPP
+
+#include <SDL.h>
+#include <array>
+#include <random>
+#include <vector>
+
+/// Particle effects, one emitter each
+enum class ParticleEffect {
+    HitSpark,    ///< Player arrow hitting an enemy or a boss
+    DeathBurst,  ///< Enemy or boss destroyed
+    Trail,       ///< Left behind by flying projectiles
+    Count
+};
+
+/**
+ * @brief Particles of one emitter, recorded for the renderer
+ * @details Drawn with a single SDL_RenderGeometry call. Indices follow the same quad pattern
+ * every frame, so they are only ever extended, never rebuilt.
+ */
+struct ParticleBatch {
+    SDL_Texture* texture = nullptr;   ///< Texture shared by every particle of the emitter
+    std::vector<SDL_Vertex> vertices; ///< 4 vertices per particle
+    std::vector<int> indices;         ///< 6 indices per particle, at least as many as the vertices need
+
+    /**
+     * @brief Get the number of indices to draw for the recorded vertices
+     */
+    int getIndexCount() const { return static_cast<int>(vertices.size() / 4 * 6); }
+};
+
+/**
+ * @brief Fixed-capacity particle storage, one array per attribute
+ * @details Live particles are packed at the front, a dead one is replaced by the last one.
+ * The update is one branch-free pass over the attribute arrays, in blocks the compiler vectorizes.
+ */
+class ParticlePool {
+public:
+    /// Maximum number of live particles
+    static constexpr int Capacity = 4096;
+
+    /// Particles moved per block of the update, the capacity is a multiple of it
+    static constexpr int BlockWidth = 8;
+
+    /**
+     * @brief Add a particle if there is room
+     * @return False if the pool is full
+     */
+    bool add(float x, float y, float velocityX, float velocityY, float lifetime);
+
+    /**
+     * @brief Move every particle and drop the expired ones
+     * @param deltaTime Time elapsed since last update (in seconds)
+     * @param drag Fraction of the velocity lost per second
+     * @param gravity Downward acceleration in pixels per second squared
+     */
+    void update(float deltaTime, float drag, float gravity);
+
+    /**
+     * @brief Append one quad per particle, shrinking and fading with age
+     * @param batch Batch to append to
+     * @param size Size of a new particle in pixels
+     * @param color Color of a new particle
+     */
+    void appendQuads(ParticleBatch& batch, float size, SDL_Color color) const;
+
+    /**
+     * @brief Get the number of live particles
+     */
+    int getCount() const { return mCount; }
+
+    /**
+     * @brief Remove every particle
+     */
+    void clear() { mCount = 0; }
+
+private:
+    alignas(32) std::array<float, Capacity> mX{};
+    alignas(32) std::array<float, Capacity> mY{};
+    alignas(32) std::array<float, Capacity> mVelocityX{};
+    alignas(32) std::array<float, Capacity> mVelocityY{};
+    alignas(32) std::array<float, Capacity> mLife{};          ///< Seconds left
+    alignas(32) std::array<float, Capacity> mInverseLifetime{};  ///< 1 / total lifetime, to get the age fraction without dividing
+
+    /// Number of live particles, packed at the front of the arrays
+    int mCount = 0;
+
+    static_assert(Capacity % BlockWidth == 0, "The update runs whole blocks");
+};
+
+/**
+ * @brief Particle effects of a scene
+ * @details Runs on the simulation thread: effects are emitted and updated with the scene and
+ * recorded into the frame snapshot, one batch per emitter. At most SpawnBudget particles are
+ * spawned per frame across all emitters; emissions past the budget or a full pool are dropped,
+ * so a burst of effects can never stall a frame. Trails are emitted last in a frame,
+ * so they are the first to give way to hits and deaths.
+ */
+class ParticleSystem {
+public:
+    /// Particles spawned per frame, all emitters together
+    static constexpr int SpawnBudget = 1024;
+
+    /**
+     * @brief Create the particle texture, call on the main thread
+     * @param renderer SDL renderer
+     */
+    void init(SDL_Renderer* renderer);
+
+    /**
+     * @brief Spawn particles flying out from a point
+     * @param effect Effect to spawn
+     * @param x Position X
+     * @param y Position Y
+     * @param count Number of particles wanted, capped by the frame budget
+     */
+    void emit(ParticleEffect effect, float x, float y, int count);
+
+    /**
+     * @brief Move every particle and reset the frame's spawn budget
+     * @param deltaTime Time elapsed since last update (in seconds)
+     */
+    void update(float deltaTime);
+
+    /**
+     * @brief Record every live particle for the renderer
+     * @param batches One batch per emitter, resized as needed, vertex memory is kept between frames
+     */
+    void record(std::vector<ParticleBatch>& batches) const;
+
+    /**
+     * @brief Remove every particle
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of live particles of every emitter
+     */
+    int getLiveCount() const;
+
+private:
+    /// Pools, one per effect
+    std::array<ParticlePool, static_cast<int>(ParticleEffect::Count)> mPools;
+
+    /// Texture every emitter draws with
+    SDL_Texture* mTexture = nullptr;
+
+    /// Particles that can still be spawned this frame
+    int mBudget = SpawnBudget;
+
+    /// Random directions and speeds
+    std::minstd_rand mRandom;
+};
+
+#endif // PARTICLESYSTEM_HPP
@@ -8,7 +8,7 @@
 #ifndef PLAYER_HPP
 #define PLAYER_HPP
 
-#include "Projectile.hpp"
+#include "ProjectileList.hpp"
 #include "GameEntity.hpp"
 #include <SDL.h>
 #include <memory>
@@ -26,11 +26,11 @@ private:
     SDL_Renderer* mRenderer;
 
     /**
-     * @brief Vector storing all projectiles fired by the player
+     * @brief All projectiles fired by the player
      * @details Dynamic container for active player projectiles.
      * Allows flexible addition and removal of projectiles during gameplay.
      */
-    std::vector<std::shared_ptr<Projectile>> mProjectiles;
+    ProjectileList mProjectiles;
 
 
 public:
@@ -66,23 +66,17 @@ public:
      */
     void update(float deltaTime) override;
 
-    /**
-     * @brief Render the player and projectiles
-     * @param renderer SDL renderer used for rendering
-     */
-    void render(SDL_Renderer* renderer) override;
-
     /**
      * @brief Access the projectiles owned by the player
-     * @return Reference to the vector of player projectiles
+     * @return Reference to the list of player projectiles
      */
-    std::vector<std::shared_ptr<Projectile>>& getPlayerProjectiles() { return mProjectiles; }
+    ProjectileList& getPlayerProjectiles() { return mProjectiles; }
 
     /**
      * @brief Add a new projectile to the player's projectile list
      * @param projectile Shared pointer to the projectile to add
      */
-    void AddProjectiles(std::shared_ptr<Projectile> projectile) { mProjectiles.push_back(projectile); }
+    void AddProjectiles(std::shared_ptr<PlayerArrow> projectile) { mProjectiles.add(std::move(projectile)); }
 };
 
 
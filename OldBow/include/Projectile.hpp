@@ -1,7 +1,8 @@
 /**
  * @file Projectile.hpp
- * @brief Projectile class definition
- * Handle projectile launching, movement, and state tracking
+ * @brief Projectile class and projectile kind definitions
+ * @details Declares the projectile base entity, the policies a projectile kind is built from
+ * (movement, behaviour at the top of the screen, hitbox) and the kinds used by the game.
  */
 
 #ifndef PROJECTILE_HPP
@@ -9,11 +10,15 @@
 
 #include "TextureComponent.hpp"
 #include "GameEntity.hpp"
+#include <memory>
+#include <vector>
 
-///Width and Height of the window
+///Width and Height of the logical play field
 extern const int WINDOW_WIDTH;
 extern const int WINDOW_HEIGHT;
 
+class ProjectileList;
+
 /**
  * @brief Projectile movement types
  */
@@ -24,8 +29,36 @@ enum class ProjectileMovementType {
 };
 
 /**
- * @brief Projectile entity class
- * Projectile can be fired by both players and enemies
+ * @brief Description of a volley of hostile projectiles, spawned with Projectile::spawnVolley
+ * @details UpDown volleys are rows: projectile i starts spacingX * i to the right of the origin.
+ * Angle and Tracking volleys are fans: every projectile starts at the origin and projectile i
+ * flies at angle + angleStep * i (degrees, 0 = right, 90 = down).
+ * Upward rows bounce back down from the top of the screen (Rain attack pattern).
+ */
+struct VolleyDesc {
+    int count = 1;                        ///< Number of projectiles
+    float originX = 0.0f;                 ///< Start position of the first projectile
+    float originY = 0.0f;
+    float spacingX = 0.0f;                ///< Horizontal step between projectiles of a row
+    ProjectileMovementType movement = ProjectileMovementType::UpDown;
+    bool upward = false;                  ///< Direction of an UpDown volley
+    float angle = 90.0f;                  ///< Angle of the first projectile of a fan
+    float angleStep = 0.0f;               ///< Angle added for every next projectile of a fan
+    float speed = 350.0f;                 ///< Speed in pixels per second
+    const char* sprite = nullptr;         ///< Texture path, loaded once for the whole volley
+    float width = 0.0f;                   ///< Sprite size
+    float height = 0.0f;
+    float rotation = 0.0f;                ///< Initial sprite rotation in degrees
+    HitboxShape hitboxShape = HitboxShape::Box;
+    float hitboxScaleX = 0.0f;            ///< Hitbox size relative to the sprite, 0 keeps the kind's
+    float hitboxScaleY = 0.0f;            ///< hitbox policy scale (set both to override it)
+};
+
+/**
+ * @brief Projectile entity base
+ * @details Holds only what every kind uses: its velocity and firing state.
+ * Movement and collision behaviour come from the kind's policies (see ProjectileKind),
+ * so a projectile never branches on who fired it or how it moves.
  */
 class Projectile : public GameEntity {
 public:
@@ -34,144 +67,171 @@ public:
 
     /**
     * @brief Constructor
-    * @param renderer SDL renderer
-    */
-    Projectile(SDL_Renderer* renderer);
-
-
-    /**
-    * @brief Launch projectile in a straight direction
-    * @param x Start position X
-    * @param y Start position Y
-    * @param direction True = up, False = down
-    * @param minLaunchTime Minimum time gap between launches
-    * @return True if projectile is fired
     */
-    bool Launch(float x, float y, bool direction, float minLaunchTime=1000);
-    /**
-     * @brief Update projectile movement
-     * @param deltaTime Time elapsed since last frame
-     */
-    void update(float deltaTime) override;
-
-    /**
-     * @brief Render the projectile
-     * @param renderer SDL renderer
-     */
-    void render(SDL_Renderer* renderer) override;
+    Projectile();
 
     /**
-     * @brief Set projectile as player's projectile
-     * @param value True if belongs to player
+     * @brief Put the projectile in flight
+     * @details The caller sets the sprite size and rotation, the velocity carries the speed
+     * @param x Start position X
+     * @param y Start position Y
+     * @param velocityX Horizontal velocity in pixels per second
+     * @param velocityY Vertical velocity in pixels per second (positive is downward)
      */
-    void setIsPlayerProjectile(bool value) { isPlayerProjectile = value; }
+    void launch(float x, float y, float velocityX, float velocityY);
 
     /**
-     * @brief Get projectile speed
-     * @return Speed value
+     * @brief Skip the start of the next update for projectiles fired mid-frame
+     * @param seconds Time into the frame at which the projectile was fired
      */
-    float getProjectileSpeed() { return mSpeed; }
+    void setSubStepOffset(float seconds) { mSubStepOffset = seconds; }
 
     /**
-     * @brief Set projectile speed
-     * @param speed Speed value
-     */
-    void setProjectileSpeed(float speed) { mSpeed = speed; }
-
-   /**
-     * @brief Set owner's width for positioning
-     * @param width Width of the projectile owner
+     * @brief Stop the projectile for good, its owner erases it on the next update
+     * @details Called by the scene once the projectile has left the play field
      */
-    void setOwnerWidth(float width) { ownerWidth = width; }
+    void retire() { mIsFiring = false; setRenderable(false); }
 
     /**
-     * @brief Initialize projectile components
+     * @brief Spawn and launch a whole volley in one call
+     * @details The kind is chosen once for the volley, the texture is looked up once,
+     * the kind's batch grows once, and every projectile is written directly in its launched state
+     * @param desc Layout, sprite and hitbox of the volley
+     * @param renderer SDL renderer
+     * @param out Projectile list the volley is appended to (EX: the boss' projectiles)
      */
-    void init();
+    static void spawnVolley(const VolleyDesc& desc, SDL_Renderer* renderer, ProjectileList& out);
 
-    /**
-     * @brief Set projectile as boss's projectile
-     * @param value True if belongs to boss
-     */
-    void setIsBossProjectile(bool value) { isBossProjectile = value; }
+protected:
+    /// Projectile firing state
+    bool mIsFiring{false};
 
-    /**
-     * @brief Launch projectile at an angle
-     * @param x Start position X
-     * @param y Start position Y
-     * @param angleDegrees Launch angle in degrees
-     */
-    void LaunchWithAngle(float x, float y, float angleDegrees);
+    /// Horizontal velocity
+    float mVelocityX = 0.0f;
 
-    /**
-     * @brief Launch projectile with tracking effect
-     * @param x Start position X
-     * @param y Start position Y
-     * @param angleDegree Launch angle in degrees
-     */
-    void LaunchWithTracking(float x, float y, float angleDegree);
+    /// Vertical velocity
+    float mVelocityY = 0.0f;
 
-    /**
-     * @brief Set projectile movement type
-     * @param type Movement type enum
-     */
-    void setProjectileMovementType(ProjectileMovementType type) { mMovementType = type; }
+    /// Part of the first update to skip, set when fired in the middle of a frame
+    float mSubStepOffset = 0.0f;
 
     /**
-     * @brief Set projectile as ultimate type
-     * @param value True if ultimate projectile
+     * @brief Add the transform and hitbox components
+     * @param layer Collision layer of the hitbox
+     * @param mask Layers the hitbox collides with
+     * @param scaleX Hitbox width relative to the sprite
+     * @param scaleY Hitbox height relative to the sprite
      */
-    void setIsUltimateProjectile(bool value) { isUltimateProjectile = value; }
+    void initComponents(Uint32 layer, Uint32 mask, float scaleX, float scaleY);
 
     /**
-     * @brief Set size for ultimate projectile
-     * @param width Width value
-     * @param height Height value
+     * @brief Time the projectile travels during this update
+     * @details A projectile fired mid-frame only travels for the rest of that frame
      */
-    void setUltimateProjectileSize(float width, float height);
+    float travelTime(float deltaTime) {
+        float offset = mSubStepOffset;
+        mSubStepOffset = 0.0f;
+        return deltaTime > offset ? deltaTime - offset : 0.0f;
+    }
+};
 
-private:
-    /// SDL renderer reference
-    SDL_Renderer* mRenderer;
+/// Movement policies: how a projectile's transform follows its velocity
 
-    /// Projectile firing state
-    bool mIsFiring{false};
-
-    /// Projectile direction: true = up, false = down
-    bool mYDirectionUp{true};
+/// Straight line at constant velocity (arrows, rows and fans)
+struct StraightFlight {
+    static void step(TransformComponent& transform, float velocityX, float velocityY, float deltaTime) {
+        transform.move(transform.getX() + velocityX * deltaTime, transform.getY() + velocityY * deltaTime);
+    }
+};
 
-    /// Last time projectile was launched
-    static Uint64 lastTimeLaunch;
+/// Straight line while the sprite spins (tracking slash)
+struct SpinningFlight {
+    static constexpr float RotationSpeed = 180.0f;  ///< Degrees per second
+    static void step(TransformComponent& transform, float velocityX, float velocityY, float deltaTime) {
+        transform.setRotation(transform.getRotation() + RotationSpeed * deltaTime);
+        StraightFlight::step(transform, velocityX, velocityY, deltaTime);
+    }
+};
 
-    /// Projectile speed
-    float mSpeed;
+/// Top of screen policies: what happens when a projectile reaches y = 0
 
-    /// True if projectile is fired by player
-    bool isPlayerProjectile{false};
+/// Keeps flying, the scene retires it once it has left the play field
+struct PassTop {
+    static void apply(TransformComponent&, float&) {}
+};
 
-    /// True if projectile is fired by boss
-    bool isBossProjectile{false};
+/// Bounces back down 1.5 times faster, pointing downward (Rain attack pattern)
+struct BounceAtTop {
+    static void apply(TransformComponent& transform, float& velocityY) {
+        if (velocityY < 0.0f && transform.getY() <= 0.0f) {
+            velocityY *= -1.5f;
+            transform.setRotation(0.0f);
+        }
+    }
+};
 
-    /// Width of projectile owner for positioning
-    float ownerWidth{0.0f};
+/// Hitbox policies: collision layers and default hitbox size relative to the sprite
 
-    /// Horizontal velocity
-    float mVelocityX = 0.0f;
-
-    /// Vertical velocity
-    float mVelocityY = 0.0f;
+/// Player arrows hit enemies and bosses, full size hitbox
+struct PlayerHitbox {
+    static constexpr Uint32 Layer = CollisionLayer::PlayerProjectile;
+    static constexpr Uint32 Mask = CollisionLayer::Enemy | CollisionLayer::Boss;
+    static constexpr float ScaleX = 1.0f;
+    static constexpr float ScaleY = 1.0f;
+};
 
-    /// Projectile movement type
-    ProjectileMovementType mMovementType = ProjectileMovementType::UpDown;
+/// Minion arrows hit the player, full size hitbox
+struct MinionHitbox {
+    static constexpr Uint32 Layer = CollisionLayer::HostileProjectile;
+    static constexpr Uint32 Mask = CollisionLayer::Player;
+    static constexpr float ScaleX = 1.0f;
+    static constexpr float ScaleY = 1.0f;
+};
 
-    /// True if ultimate projectile
-    bool isUltimateProjectile{false};
+/// Boss projectiles hit the player, hitbox shrunk for forgiveness (volleys may override it)
+struct BossHitbox {
+    static constexpr Uint32 Layer = CollisionLayer::HostileProjectile;
+    static constexpr Uint32 Mask = CollisionLayer::Player;
+    static constexpr float ScaleX = 0.6f;
+    static constexpr float ScaleY = 0.6f;
+};
 
-    /// Width for ultimate projectile
-    float mUltimateProjectileWidth;
+/**
+ * @brief Projectile kind assembled from compile-time policies
+ * @details The kind is final, so a batch of one kind calls update() without a virtual dispatch,
+ * and the policies inline into a branch-free step.
+ * @tparam Movement Movement policy
+ * @tparam TopEdge Top of screen policy
+ * @tparam Hitbox Hitbox policy
+ */
+template <typename Movement, typename TopEdge, typename Hitbox>
+class ProjectileKind final : public Projectile {
+public:
+    /**
+     * @brief Initialize projectile components, on the kind's collision layer
+     */
+    void init() { initComponents(Hitbox::Layer, Hitbox::Mask, Hitbox::ScaleX, Hitbox::ScaleY); }
 
-    /// Height for ultimate projectile
-    float mUltimateProjectileHeight;
+    /**
+     * @brief Update projectile movement
+     * @details Projectiles leaving the play field are retired by the scene's visibility pass,
+     * the hitbox is moved by the scene's collision pass
+     * @param deltaTime Time elapsed since last frame
+     */
+    void update(float deltaTime) override {
+        if (!mIsFiring) {
+            return;
+        }
+        Movement::step(*mTransform, mVelocityX, mVelocityY, travelTime(deltaTime));
+        TopEdge::apply(*mTransform, mVelocityY);
+    }
 };
 
+/// Projectile kinds of the game
+using PlayerArrow = ProjectileKind<StraightFlight, PassTop, PlayerHitbox>;   ///< Fired by the player
+using MinionArrow = ProjectileKind<StraightFlight, PassTop, MinionHitbox>;   ///< Fired by enemies
+using BossShot = ProjectileKind<StraightFlight, PassTop, BossHitbox>;        ///< Boss fans and downward rows
+using RainShot = ProjectileKind<StraightFlight, BounceAtTop, BossHitbox>;    ///< Boss upward rows
+using SlashShot = ProjectileKind<SpinningFlight, PassTop, BossHitbox>;       ///< Boss tracking slash
+
 #endif // PROJECTILE_HPP
@@ -0,0 +1,126 @@
+/**
+ * @file ProjectileList.hpp
+ * @brief ProjectileList class definition
+ * @details Declares the projectile container of an owner (player, enemy, boss or the scene's
+ * orphaned projectiles), which keeps one homogeneous batch per projectile kind.
+ */
+
+#ifndef PROJECTILELIST_HPP
+#define PROJECTILELIST_HPP
+
+#include "Projectile.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Projectiles of one owner, stored as one batch per kind
+ * @details Updating walks each batch with its kind's own update(), so the per-projectile
+ * step is inlined and never dispatches on the kind. Passes that do not care about the kind
+ * (collision, culling, drawing) visit every projectile through forEach().
+ */
+class ProjectileList {
+public:
+    /// Batch of one projectile kind
+    template <typename Kind>
+    using Batch = std::vector<std::shared_ptr<Kind>>;
+
+    /**
+     * @brief Get the batch of a projectile kind
+     * @tparam Kind One of the projectile kinds (EX: PlayerArrow)
+     */
+    template <typename Kind>
+    Batch<Kind>& batch() { return std::get<Batch<Kind>>(mBatches); }
+
+    /**
+     * @brief Add a launched projectile to its kind's batch
+     * @param projectile Projectile to add
+     */
+    template <typename Kind>
+    void add(std::shared_ptr<Kind> projectile) { batch<Kind>().push_back(std::move(projectile)); }
+
+    /**
+     * @brief Update every projectile, one batch at a time
+     * @param deltaTime Time elapsed since last frame
+     */
+    void update(float deltaTime) {
+        std::apply([deltaTime](auto&... batches) { (updateBatch(batches, deltaTime), ...); }, mBatches);
+    }
+
+    /**
+     * @brief Erase the projectiles that are no longer rendered (hit or retired)
+     */
+    void removeInactive() {
+        std::apply([](auto&... batches) { (eraseInactive(batches), ...); }, mBatches);
+    }
+
+    /**
+     * @brief Visit every projectile, batch by batch
+     * @param function Called with a Projectile& for each projectile
+     */
+    template <typename Function>
+    void forEach(Function&& function) const {
+        std::apply([&function](const auto&... batches) {
+            (visit(batches, function), ...);
+        }, mBatches);
+    }
+
+    /**
+     * @brief Move every projectile of another list into this one (EX: orphans of a dead enemy)
+     * @param other List to empty
+     */
+    void takeAll(ProjectileList& other) {
+        std::apply([&other](auto&... batches) { (append(batches, other), ...); }, mBatches);
+    }
+
+    /**
+     * @brief Get the number of projectiles of every kind
+     */
+    std::size_t size() const {
+        return std::apply([](const auto&... batches) { return (batches.size() + ... + std::size_t(0)); }, mBatches);
+    }
+
+    /**
+     * @brief Destroy every projectile
+     */
+    void clear() {
+        std::apply([](auto&... batches) { (batches.clear(), ...); }, mBatches);
+    }
+
+private:
+    /// One batch per projectile kind
+    std::tuple<Batch<PlayerArrow>, Batch<MinionArrow>, Batch<BossShot>, Batch<RainShot>, Batch<SlashShot>> mBatches;
+
+    template <typename Kind>
+    static void updateBatch(Batch<Kind>& projectiles, float deltaTime) {
+        for (auto& projectile : projectiles) {
+            projectile -> update(deltaTime);  ///< Kind is final, the call is resolved at compile time
+        }
+    }
+
+    template <typename Kind>
+    static void eraseInactive(Batch<Kind>& projectiles) {
+        projectiles.erase(std::remove_if(projectiles.begin(), projectiles.end(),
+                                         [](const std::shared_ptr<Kind>& projectile) { return !projectile -> getRenderable(); }),
+                          projectiles.end());
+    }
+
+    template <typename Kind, typename Function>
+    static void visit(const Batch<Kind>& projectiles, Function& function) {
+        for (auto& projectile : projectiles) {
+            function(static_cast<Projectile&>(*projectile));
+        }
+    }
+
+    template <typename Kind>
+    static void append(Batch<Kind>& projectiles, ProjectileList& other) {
+        Batch<Kind>& source = other.batch<Kind>();
+        projectiles.insert(projectiles.end(), std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+        source.clear();
+    }
+};
+
+#endif // PROJECTILELIST_HPP
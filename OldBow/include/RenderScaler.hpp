@@ -0,0 +1,60 @@
+/**
+ * @file RenderScaler.hpp
+ * @brief RenderScaler class definition
+ * @details Declares the dynamic resolution scaler, which picks the resolution the scene layers
+ * are drawn at (see LayerCompositor) from the frame timings.
+ */
+
+#ifndef RENDERSCALER_HPP
+#define RENDERSCALER_HPP
+
+#include <SDL.h>
+
+struct FrameTiming;
+
+/**
+ * @brief Dynamic resolution for the scene layers
+ * @details Every 30 frames the scale drops a step if too many frames missed the budget while the
+ * main thread (draw and present) was the slowest stage. After enough clean windows it probes
+ * one step back up; a probe that misses again doubles the wait before the next one.
+ */
+class RenderScaler {
+public:
+    /// Lowest and highest resolution scale, and the step between them
+    static constexpr float MinScale = 0.5f;
+    static constexpr float MaxScale = 1.0f;
+    static constexpr float ScaleStep = 0.125f;
+
+    /**
+     * @brief Feed the timing of a finished frame and adjust the scale
+     * @param timing Stage timings of the frame
+     * @param budgetMs Target frame period in milliseconds
+     */
+    void recordFrame(const FrameTiming& timing, double budgetMs);
+
+    /**
+     * @brief Get the current resolution scale (1 is the full logical resolution)
+     */
+    float getScale() const { return mScale; }
+
+private:
+    /// Current resolution scale
+    float mScale = MaxScale;
+
+    /// Frames recorded in the current window
+    int mFrames = 0;
+
+    /// Frames of the current window that missed the budget because of drawing
+    int mMisses = 0;
+
+    /// Consecutive windows without misses
+    int mCleanWindows = 0;
+
+    /// Clean windows needed before probing a higher scale
+    int mProbeDelay = 4;
+
+    /// True during the first window after a probe
+    bool mProbing = false;
+};
+
+#endif // RENDERSCALER_HPP
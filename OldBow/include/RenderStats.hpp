@@ -0,0 +1,15 @@
+/**
+ * @file RenderStats.hpp
+ * @brief Per-frame render statistics
+ * @details Declares the draw call counter shown by the debug overlay.
+ */
+
+#ifndef RENDERSTATS_HPP
+#define RENDERSTATS_HPP
+
+namespace RenderStats {
+    /// Number of SDL draw calls issued since the start of the current frame
+    extern unsigned int drawCalls;
+}
+
+#endif // RENDERSTATS_HPP
@@ -11,6 +11,7 @@
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 #include <iostream>
 
 /**
@@ -26,6 +27,9 @@ private:
     /// Store loaded textures as shared pointers
     static std::unordered_map<std::string, std::shared_ptr<SDL_Texture>> textureMap;
 
+    /// Thread that owns the renderer, the only one allowed to create textures (0 = any thread)
+    static SDL_threadID renderThread;
+
     /// Private constructor to enforce singleton pattern
     ResourceManager() {}
 
@@ -49,6 +53,57 @@ public:
      */
     static std::shared_ptr<SDL_Texture> LoadTexture(const std::string& filepath, SDL_Renderer* renderer);
 
+    /**
+     * @brief Start decoding textures on the loader thread, without waiting for them
+     * @details Decoded images are uploaded by uploadDecoded() / finishPreloads() on the render thread.
+     * Paths already cached are skipped. Textures used by the simulation thread (EX: projectile
+     * sprites) must be preloaded, since SDL only allows creating them on the render thread.
+     * @param filepaths Paths to the BMP files
+     */
+    static void preloadTexturesAsync(const std::vector<std::string>& filepaths);
+
+    /**
+     * @brief Upload some of the images decoded so far. Render thread only.
+     * @param renderer SDL renderer
+     * @param maxCount Most textures created by this call, to spread uploads over frames
+     * @return Number of textures created
+     */
+    static int uploadDecoded(SDL_Renderer* renderer, int maxCount);
+
+    /**
+     * @brief Wait for every asynchronous preload and upload it. Render thread only.
+     * @param renderer SDL renderer
+     */
+    static void finishPreloads(SDL_Renderer* renderer);
+
+    /**
+     * @brief Stop the loader thread, call before SDL_Quit
+     */
+    static void shutDown();
+
+    /**
+     * @brief Cache a texture from an image decoded elsewhere (EX: by the dialogue loader)
+     * @details Keeps the cached texture if the path is already loaded. Render thread only.
+     * @param filepath Path the image was read from, used as the cache key
+     * @param surface Decoded image, freed by this call
+     * @param renderer SDL renderer
+     * @return Shared pointer to the cached texture
+     */
+    static std::shared_ptr<SDL_Texture> AddTexture(const std::string& filepath, SDL_Surface* surface, SDL_Renderer* renderer);
+
+    /**
+     * @brief Get a texture only if it is already cached, never loads
+     * @param filepath Path to the BMP file
+     * @return Shared pointer to the texture, nullptr if not cached
+     */
+    static std::shared_ptr<SDL_Texture> GetCachedTexture(const std::string& filepath);
+
+    /**
+     * @brief Mark the calling thread as the render thread
+     * @details Cache misses on any other thread are reported instead of touching the renderer
+     */
+    static void setRenderThread() { renderThread = SDL_ThreadID(); }
+
 };
 
 #endif // RESOURCEMANAGER_HPP
@@ -12,10 +12,20 @@
 #include "SDL.h"
 #include "Player.hpp"
 #include "Enemy.hpp"
-#include "Projectile.hpp"
+#include "ProjectileList.hpp"
 #include "Boss.hpp"
+#include "DebugOverlay.hpp"
+#include "SceneArena.hpp"
+#include "CollisionSystem.hpp"
+#include "FrameSnapshot.hpp"
+#include "TimerWheel.hpp"
+#include "ParticleSystem.hpp"
+#include "CompiledAssets.hpp"
+#include <functional>
+#include <random>
 #include <vector>
 #include <memory>
+#include <string>
 
 /// Enum to specify different types of scenes
 enum class SceneType {
@@ -35,8 +45,14 @@ private:
     /// Current scene type (Boss1, Boss2, Boss3)
     SceneType mSceneType;
 
+    /**
+     * @brief Memory for every entity and component of this scene
+     * @note Declared before the entity containers so it outlives them
+     */
+    SceneArena mArena;
+
     /// Stores projectiles from dead enemies and bosses to prolong their existence
-    std::vector<std::shared_ptr<Projectile>> globalProjectiles;
+    ProjectileList globalProjectiles;
 
     /// Vectors storing enemies and bosses
     std::vector<std::shared_ptr<Enemy>> enemies;
@@ -61,12 +77,118 @@ private:
     /// Flag to check if phase enemies have been spawned (Boss 3 only)
     bool spawnedPhaseEnemies = false;
 
+    /// Who fired a hostile projectile, ordered by which death dialogue takes precedence
+    enum class ColliderTag {
+        None,
+        FiredByBoss,
+        FiredByEnemy,
+        Lingering  ///< Orphaned projectile of a dead enemy / boss
+    };
+
+    /**
+     * @brief Enemy shots, boss attack cooldowns and ultimate fire periods, on simulation time
+     * @note Declared after the arena, its callbacks reference entities allocated from it
+     */
+    TimerWheel mTimers;
+
+    /// Finds this frame's contacts between all hitboxes of the scene
+    CollisionSystem mCollisions;
+
+    /// Bosses / enemies already hit this frame (reused between frames)
+    std::vector<GameEntity*> mTargetHit;
+
+    /// Hit sparks, death bursts and projectile trails
+    ParticleSystem mParticles;
+
+    /// Live entities found off-screen by the last visibility pass
+    int mCulledCount = 0;
+
+    /// Projectiles retired for leaving the play field since the scene started
+    unsigned int mRetiredCount = 0;
+
+    /// True once prepareBattle() created the battle entities
+    bool mBattleReady = false;
+
+    /// Background image of the battle, loaded while the opening dialogue plays
+    std::string mBattleBackground;
+
+    /// Create the battle entities and textures, when the opening dialogue ends
+    void prepareBattle();
+
     /// Private setup functions
     void initMainCharacter();
     void initEnemies(int numEnemies);
     void initBoss();
     void resetSceneState();
 
+    /// Collision pass over every entity and projectile of the scene
+    void syncColliders();
+
+    /// Apply this frame's contacts (hits, player death)
+    void resolveContacts();
+
+    /// Visibility pass: flag off-screen sprites and retire projectiles that left the play field
+    void cullAndRetire();
+
+    /// Leave a trail particle behind every projectile in flight
+    void emitTrails();
+
+    /**
+     * @brief Scene state at the start of combat, rewound to when the player is defeated
+     * @details Plain values only: entities are rebuilt from it with textures from the resource cache
+     * and memory from the arena's free lists, so a retry touches neither the disk nor the GPU.
+     * Timers are not stored, at the start of combat every one of them is at its first delay,
+     * so the rebuilt entities register them again.
+     */
+    struct Checkpoint {
+        bool valid = false;
+
+        /// Entity placement and state
+        struct BossState {
+            CompiledAssets::BossDefinition definition;
+            float x, y;
+            int hp;
+        };
+        struct EnemyState {
+            float x, y;
+            float fireInterval;  ///< Milliseconds between shots
+        };
+        float playerX = 0.0f;
+        float playerY = 0.0f;
+        std::vector<BossState> bosses;
+        std::vector<EnemyState> enemies;
+
+        /// Shared enemy movement
+        float enemyMovement = 0.0f;
+        float enemyTotalMovement = 0.0f;
+        float enemyMovementThreshold = 0.0f;
+        bool enemyMovingRight = true;
+
+        /// Random engines, so the retry plays out the same way
+        std::mt19937 directionEngine;
+        std::mt19937 fireIntervalEngine;
+
+        /// Scene flags
+        bool spawnedPhaseEnemies = false;
+        int playerScore = 0;
+    };
+    Checkpoint mCheckpoint;
+
+    /// Save the scene state when combat starts
+    void takeCheckpoint();
+
+    /// Rewind to the checkpoint and resume combat (defeat retry)
+    void restoreCheckpoint();
+
+    /// Work queued by the simulation for the main thread (anything touching the renderer)
+    std::vector<std::function<void()>> mMainThreadJobs;
+
+    /**
+     * @brief Queue work that needs the renderer (EX: loading a dialogue background)
+     * @param job Work to run on the main thread after this frame's simulation
+     */
+    void runOnMainThread(std::function<void()> job);
+
 public:
 
     /// Background texture for the scene
@@ -74,15 +196,16 @@ public:
 
     // Scene lifecycle
     /**
-     * @brief Initializes the scene, loads background and sets up game entities
+     * @brief Initializes the scene: starts the opening dialogue, the battle is loaded while it plays
      * @param renderer SDL renderer for drawing
      */
     void SceneStartUp(SDL_Renderer* renderer);
 
     /**
-     * @brief Shuts down the scene (reserved for future clean-up if needed)
+     * @brief Shuts down the scene, destroys its entities and resets its arena
+     * @details Reports how many allocations and bytes the scene used
      */
-    void SceneShutDown() {}
+    void SceneShutDown();
 
 
     // Game loop delegation
@@ -99,10 +222,17 @@ public:
     void update(float deltaTime);
 
     /**
-     * @brief Renders all entities and background
-     * @param renderer SDL renderer for drawing
+     * @brief Records the background and visible sprites of this frame for the renderer
+     * @details Called on the simulation thread, the snapshot is drawn by the main thread
+     * while the next frame is simulated
+     * @param snapshot Snapshot to fill
+     */
+    void buildSnapshot(FrameSnapshot& snapshot) const;
+
+    /**
+     * @brief Run the work the last simulated frame queued for the main thread
      */
-    void render(SDL_Renderer* renderer);
+    void runMainThreadJobs();
 
     /**
      * @brief Sets the scene's active status
@@ -128,6 +258,12 @@ public:
      */
     SceneType GetSceneType() const { return mSceneType; }
 
+    /**
+     * @brief Counts live entities and projectiles by owner, for the debug overlay
+     * @return Entity counts of the scene
+     */
+    SceneEntityCounts getEntityCounts() const;
+
 
 
 };
@@ -0,0 +1,189 @@
+/**
+ * @file SceneArena.hpp
+ * @brief SceneArena class and ArenaAllocator definitions
+ * @details Declares the per-scene memory arena that all scene-owned entities and components
+ * are allocated from, and the allocator adapter used with std::allocate_shared.
+ */
+
+#ifndef SCENEARENA_HPP
+#define SCENEARENA_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Monotonic arena with a size-class pool on top
+ * @details Memory is carved out of 64 KB chunks. Blocks up to 512 bytes are rounded to a
+ * 16 byte size class, and freed blocks go on that class' free list, so projectiles spawned
+ * and destroyed every frame keep reusing the same memory. Larger blocks are never reused
+ * until the whole arena is reset at scene shut down.
+ */
+class SceneArena {
+public:
+    /// Allocation metrics of one arena
+    struct Stats {
+        std::size_t allocations = 0;      ///< Number of allocations since the last reset
+        std::size_t bytesAllocated = 0;   ///< Bytes handed out since the last reset (after rounding)
+        std::size_t liveAllocations = 0;  ///< Allocations not freed yet
+        std::size_t liveBytes = 0;        ///< Bytes not freed yet
+        std::size_t peakLiveBytes = 0;    ///< Highest value of liveBytes
+        std::size_t reservedBytes = 0;    ///< Bytes requested from the system for chunks
+    };
+
+    /**
+     * @brief Constructor, chunks are only reserved on the first allocation
+     */
+    SceneArena() = default;
+
+    /**
+     * @brief Destructor, returns every chunk to the system
+     */
+    ~SceneArena();
+
+    /// The arena owns its chunks, so it cannot be copied
+    SceneArena(const SceneArena&) = delete;
+    SceneArena& operator=(const SceneArena&) = delete;
+
+    /**
+     * @brief Allocate a block
+     * @param bytes Size of the block
+     * @param alignment Alignment of the block
+     * @return Pointer to the block
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment);
+
+    /**
+     * @brief Free a block
+     * @details Pooled blocks go back on their free list, larger blocks wait for reset()
+     * @param pointer Block returned by allocate()
+     * @param bytes Size passed to allocate()
+     */
+    void deallocate(void* pointer, std::size_t bytes);
+
+    /**
+     * @brief Release every chunk at once
+     * @details Refuses (and reports) if blocks are still alive, since something still points into the arena
+     * @return True if the arena was reset
+     */
+    bool reset();
+
+    /**
+     * @brief Get the allocation metrics since the last reset
+     */
+    const Stats& getStats() const { return mStats; }
+
+    /**
+     * @brief Get the arena new scene entities are allocated from
+     * @return Current arena, nullptr if entities use the global heap
+     */
+    static SceneArena* current() { return sCurrent; }
+
+    /**
+     * @brief Set the arena new scene entities are allocated from
+     * @param arena Arena of the active scene, nullptr for the global heap
+     */
+    static void setCurrent(SceneArena* arena) { sCurrent = arena; }
+
+    /**
+     * @brief Create a shared object in the current arena
+     * @details Object and control block share one arena block.
+     * Falls back to std::make_shared when no scene is active.
+     * @tparam T Type of the object
+     * @param args Constructor arguments
+     * @return Shared pointer to the new object
+     */
+    template <typename T, typename... Args>
+    static std::shared_ptr<T> makeShared(Args&&... args);
+
+private:
+    /// Size of one chunk
+    static constexpr std::size_t ChunkSize = 64 * 1024;
+
+    /// Size class step and largest pooled block
+    static constexpr std::size_t SizeClassStep = 16;
+    static constexpr std::size_t MaxPooledSize = 512;
+
+    /// Free block, stored in the block itself
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    /// Chunks reserved from the system
+    std::vector<char*> mChunks;
+
+    /// Bump pointer and end of the current chunk
+    char* mCursor = nullptr;
+    char* mEnd = nullptr;
+
+    /// One free list per size class
+    std::array<FreeBlock*, MaxPooledSize / SizeClassStep> mFreeLists{};
+
+    /// Allocation metrics
+    Stats mStats;
+
+    /// Arena of the active scene
+    static SceneArena* sCurrent;
+
+    /**
+     * @brief Bump allocate from the current chunk, reserving a new chunk if needed
+     */
+    void* allocateFromChunk(std::size_t bytes, std::size_t alignment);
+};
+
+/**
+ * @brief Standard allocator adapter over a SceneArena
+ * @tparam T Type of the allocated objects
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    /**
+     * @brief Constructor
+     * @param arena Arena to allocate from
+     */
+    explicit ArenaAllocator(SceneArena* arena) : mArena(arena) {}
+
+    /**
+     * @brief Rebind constructor, used by std::allocate_shared for the control block
+     */
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : mArena(other.getArena()) {}
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(mArena -> allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, std::size_t count) {
+        mArena -> deallocate(pointer, count * sizeof(T));
+    }
+
+    SceneArena* getArena() const { return mArena; }
+
+private:
+    /// Arena the memory comes from
+    SceneArena* mArena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.getArena() == b.getArena(); }
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.getArena() != b.getArena(); }
+
+/**
+ * @brief Create a shared object in the current arena
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> SceneArena::makeShared(Args&&... args) {
+    if (!sCurrent) {
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+    return std::allocate_shared<T>(ArenaAllocator<T>(sCurrent), std::forward<Args>(args)...);
+}
+
+#endif // SCENEARENA_HPP
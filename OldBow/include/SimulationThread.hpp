@@ -0,0 +1,79 @@
+/**
+ * @file SimulationThread.hpp
+ * @brief SimulationThread class definition
+ * @details Declares the worker thread that runs the game simulation of the next frame
+ * while the main thread renders and presents the previous one.
+ */
+
+#ifndef SIMULATIONTHREAD_HPP
+#define SIMULATIONTHREAD_HPP
+
+#include <SDL.h>
+#include <functional>
+
+/**
+ * @brief Persistent worker thread with a fork / join interface
+ * @details One job at a time: start() hands a job to the thread and returns immediately,
+ * wait() blocks until the job is done. The thread sleeps on a condition variable between jobs,
+ * so it costs nothing while the game is paused in a dialogue.
+ * SDL threads are used so the game keeps building with MinGW's win32 thread model.
+ */
+class SimulationThread {
+public:
+
+    /**
+     * @brief Constructor, starts the worker thread
+     */
+    SimulationThread();
+
+    /**
+     * @brief Destructor, waits for the current job and stops the worker thread
+     */
+    ~SimulationThread();
+
+    /// Owns a thread, cannot be copied
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    /**
+     * @brief Run a job on the worker thread
+     * @details Must not be called again before wait() returned
+     * @param job Work to run
+     */
+    void start(std::function<void()> job);
+
+    /**
+     * @brief Block until the job given to start() has finished
+     * @details Returns immediately if no job is running
+     */
+    void wait();
+
+private:
+    /// Worker thread, nullptr if it could not be created (jobs then run on the caller's thread)
+    SDL_Thread* mThread = nullptr;
+
+    /// Guards every member below
+    SDL_mutex* mMutex = nullptr;
+
+    /// Signalled when a job is given or the thread has to stop
+    SDL_cond* mJobReady = nullptr;
+
+    /// Signalled when a job has finished
+    SDL_cond* mJobDone = nullptr;
+
+    /// Job to run, empty when the worker is idle
+    std::function<void()> mJob;
+
+    /// True while a job is queued or running
+    bool mBusy = false;
+
+    /// True when the destructor asks the worker to exit
+    bool mStopping = false;
+
+    /**
+     * @brief Worker thread body: run jobs until asked to stop
+     */
+    static int run(void* data);
+};
+
+#endif // SIMULATIONTHREAD_HPP
@@ -0,0 +1,58 @@
+/**
+ * @file StartupTrace.hpp
+ * @brief StartupTrace class definition
+ * @details Declares the timer that splits the start of the game into phases,
+ * from main() to the first frame showing the opening dialogue.
+ */
+
+#ifndef STARTUPTRACE_HPP
+#define STARTUPTRACE_HPP
+
+#include <SDL.h>
+
+/**
+ * @brief Times the start up phase by phase
+ * @details Each mark() closes the phase started by the previous one. finish() closes the last
+ * phase, logs every phase and the time to first frame. Main thread only; work done on other
+ * threads is reported with its own duration through record().
+ * @example
+ * StartupTrace::mark("window");
+ */
+class StartupTrace {
+public:
+    /**
+     * @brief Start timing, call first thing in main()
+     */
+    static void begin();
+
+    /**
+     * @brief Close the current phase
+     * @param phase Name of the phase that just ended (string literal)
+     */
+    static void mark(const char* phase);
+
+    /**
+     * @brief Report work that ran on another thread, overlapped with the phases
+     * @param task Name of the work (string literal)
+     * @param ms Time the work took, in milliseconds
+     */
+    static void record(const char* task, double ms);
+
+    /**
+     * @brief Close the last phase and log the report
+     * @param phase Name of the last phase (string literal)
+     */
+    static void finish(const char* phase);
+
+    /**
+     * @brief Check if the report was logged
+     */
+    static bool isFinished();
+
+    /**
+     * @brief Get milliseconds elapsed since begin()
+     */
+    static double elapsedMs();
+};
+
+#endif // STARTUPTRACE_HPP
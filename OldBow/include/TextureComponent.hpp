@@ -7,15 +7,24 @@
 #ifndef TEXTURECOMPONENT_HPP
 #define TEXTURECOMPONENT_HPP
 #include "Component.hpp"
+#include "TransformComponent.hpp"
 #include <SDL.h>
 #include <string>
 #include <memory>
+#include <vector>
+
+/// One recorded texture draw, replayed later by the renderer
+struct SpriteCommand {
+    SDL_Texture* texture;  ///< Texture to draw
+    SDL_FRect rect;        ///< Destination rectangle
+    float rotation;        ///< Rotation in degrees around the rectangle's center
+};
 
 /**
  * @brief Component for handling textures
  * Manage texture assignment and rendering for entities
  */
-class TextureComponent : public Component {
+class TextureComponent final : public Component {
 private:
 
     /// Texture used by this component
@@ -43,10 +52,21 @@ public:
     void CreateHero(SDL_Renderer* renderer, const std::string& filePath);
 
     /**
-     * @brief Render the texture
-     * @param renderer SDL renderer
+     * @brief Use an already loaded texture (EX: one texture shared by a whole volley)
+     * @param texture Texture to draw
+     */
+    void setTexture(std::shared_ptr<SDL_Texture> texture) { mTexture = std::move(texture); }
+
+    /**
+     * @brief Record the draw instead of issuing it, for frame snapshots
+     * @param sprites Sprite list to append to
+     * @param transform Transform of the owning entity
      */
-    void render(SDL_Renderer* renderer) override;
+    void record(std::vector<SpriteCommand>& sprites, const TransformComponent& transform) const {
+        if (mTexture) {
+            sprites.push_back({ mTexture.get(), transform.getRectangle(), transform.getRotation() });
+        }
+    }
 
     /**
      * @brief Get component type
@@ -0,0 +1,90 @@
+/**
+ * @file TextureLoader.hpp
+ * @brief TextureLoader class definition
+ * @details Declares the background loader that decodes BMP images off the main thread,
+ * so the render thread only has to upload them.
+ */
+
+#ifndef TEXTURELOADER_HPP
+#define TEXTURELOADER_HPP
+
+#include <SDL.h>
+#include <deque>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Decodes images on a worker thread
+ * @details Every requested image is decoded once into a surface and waits until the render thread
+ * takes it and turns it into a texture. All public methods are called from the main thread.
+ */
+class TextureLoader {
+public:
+
+    /**
+     * @brief Destructor, stops the worker thread
+     */
+    ~TextureLoader() { shutDown(); }
+
+    /**
+     * @brief Queue an image for decoding
+     * @details Does nothing if the image was already requested
+     * @param filePath Path to the BMP file
+     */
+    void request(const std::string& filePath);
+
+    /**
+     * @brief Take one decoded image, if any is waiting
+     * @param path Set to the image path
+     * @return Surface now owned by the caller, nullptr if none is waiting
+     */
+    SDL_Surface* take(std::string& path);
+
+    /**
+     * @brief Block until every requested image is decoded
+     */
+    void waitIdle();
+
+    /**
+     * @brief Stop the worker thread and free every surface still waiting
+     * @details Call before SDL_Quit
+     */
+    void shutDown();
+
+private:
+    /// Worker thread, started by the first request
+    SDL_Thread* mThread = nullptr;
+
+    /// Guards every member below
+    SDL_mutex* mMutex = nullptr;
+
+    /// Signalled when an image is queued or the worker has to stop
+    SDL_cond* mWork = nullptr;
+
+    /// Signalled when the worker runs out of images
+    SDL_cond* mIdle = nullptr;
+
+    /// True when the worker has to exit
+    bool mStopping = false;
+
+    /// True while the worker decodes an image it took from the queue
+    bool mBusy = false;
+
+    /// Images waiting to be decoded
+    std::deque<std::string> mQueue;
+
+    /// Every requested image
+    std::set<std::string> mRequested;
+
+    /// Decoded images waiting for the render thread
+    std::vector<std::pair<std::string, SDL_Surface*>> mDecoded;
+
+    /**
+     * @brief Worker thread body: decode queued images until asked to stop
+     */
+    static int run(void* data);
+};
+
+#endif // TEXTURELOADER_HPP
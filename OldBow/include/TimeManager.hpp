@@ -4,17 +4,29 @@
  * Provide timing utilities for frame management
  */
 
+#ifndef TIMEMANAGER_HPP
+#define TIMEMANAGER_HPP
+
 #include <SDL.h>
 
 /**
  * @brief Namespace for managing time-related functions
  */
 namespace TimeManager {
-    /// Store last update time in milliseconds
-    extern Uint32 lastUpdateTime;
+    /// Store last update time as a high resolution performance counter value
+    extern Uint64 lastUpdateTime;
 
     /**
      * @brief Reset last update timestamp
      */
     void resetLastUpdateTime();
+
+    /**
+     * @brief Get the time elapsed between the last update and a given time
+     * @param now Performance counter value (EX: start of the current frame)
+     * @return Elapsed time in seconds
+     */
+    float getDeltaTime(Uint64 now);
 }
+
+#endif // TIMEMANAGER_HPP
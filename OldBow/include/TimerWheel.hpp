@@ -0,0 +1,100 @@
+/**
+ * @file TimerWheel.hpp
+ * @brief TimerWheel class definition
+ * @details Declares the scene-wide scheduler that runs timed callbacks (enemy shots,
+ * boss attack cooldowns, ultimate fire periods) on simulation time.
+ */
+
+#ifndef TIMERWHEEL_HPP
+#define TIMERWHEEL_HPP
+
+#include <SDL.h>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Hierarchical timer wheel driven by the simulation's deltaTime
+ * @details Time advances in 1 ms ticks. Level 0 holds the timers due within the current
+ * 64 ticks, one slot per tick; each higher level covers 64 times the span of the level below.
+ * When the clock enters a new span, the matching slot of the level above is cascaded down,
+ * so every timer is moved at most three times before it fires. Advancing the clock costs one
+ * slot per tick plus the timers actually due, whatever the number of entities waiting.
+ * Only the scene's update advances the wheel, so timers stop in dialogues and do not depend
+ * on wall-clock ticks.
+ */
+class TimerWheel {
+public:
+    /// Callback run when a timer is due
+    using Callback = std::function<void()>;
+
+    /// Length of one tick in seconds
+    static constexpr float TickSeconds = 0.001f;
+
+    /**
+     * @brief Run a callback once after a delay
+     * @details A callback may schedule more timers (EX: the next shot of a repeating attack).
+     * Those fire on a later tick, even with a delay of 0.
+     * @param delay Delay in seconds of simulation time
+     * @param callback Work to run when the delay has elapsed
+     */
+    void schedule(float delay, Callback callback);
+
+    /**
+     * @brief Move the clock forward and run every callback that became due
+     * @param deltaTime Simulation time elapsed since last update (in seconds)
+     */
+    void advance(float deltaTime);
+
+    /**
+     * @brief Drop every pending timer without running it
+     * @details The scene calls this before resetting its arena, as callbacks hold entity references
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of timers waiting to fire
+     */
+    std::size_t getPendingCount() const { return mPending; }
+
+private:
+    /// Wheel layout: 4 levels of 64 slots cover 2^24 ticks (about 4.6 hours)
+    static constexpr int LevelBits = 6;
+    static constexpr int SlotCount = 1 << LevelBits;
+    static constexpr int LevelCount = 4;
+    static constexpr Uint64 MaxDelayTicks = (Uint64(1) << (LevelBits * LevelCount)) - 1;
+
+    /// One pending callback
+    struct Timer {
+        Uint64 expiry;      ///< Tick at which it fires
+        Callback callback;  ///< Work to run
+    };
+
+    /// Timers per level and slot, kept between ticks to reuse their memory
+    std::array<std::array<std::vector<Timer>, SlotCount>, LevelCount> mSlots;
+
+    /// Timers of the slot being fired (reused between ticks)
+    std::vector<Timer> mDue;
+
+    /// Current tick
+    Uint64 mNow = 0;
+
+    /// Fraction of a tick not applied yet
+    double mRemainder = 0.0;
+
+    /// Number of timers waiting to fire
+    std::size_t mPending = 0;
+
+    /**
+     * @brief Put a timer in the slot matching its expiry
+     */
+    void insert(Timer&& timer);
+
+    /**
+     * @brief Advance the clock by one tick and fire what is due
+     */
+    void tick();
+};
+
+#endif // TIMERWHEEL_HPP
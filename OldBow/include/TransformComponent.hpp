@@ -9,7 +9,7 @@
 #include "Component.hpp"
 
 
-/// Window width and height
+/// Logical play field width and height
 extern const int WINDOW_WIDTH;
 extern const int WINDOW_HEIGHT;
 
@@ -18,7 +18,7 @@ extern const int WINDOW_HEIGHT;
  * @brief Component for handling transform properties
  * Manage position, size, rotation, and movement of entities
  */
-class TransformComponent : public Component {
+class TransformComponent final : public Component {
 private:
 
      /// Texture position and size (x, y, width, height)
@@ -53,7 +53,7 @@ public:
      * @brief Get current rotation angle
      * @return Rotation in degrees
      */
-    float getRotation() {
+    float getRotation() const {
         return mRotation;
     }
 
@@ -121,7 +121,7 @@ public:
      * @brief Get rectangle for collision checking
      * @return SDL_FRect structure
      */
-    SDL_FRect getRectangle() { return mRectangle; }
+    SDL_FRect getRectangle() const { return mRectangle; }
 
     /**
      * @brief Handle input (unused)
@@ -0,0 +1,74 @@
+/**
+ * @file TripleBuffer.hpp
+ * @brief TripleBuffer class definition
+ * @details Declares the lock-free handoff used to pass frame snapshots from the
+ * simulation thread to the render thread.
+ */
+
+#ifndef TRIPLEBUFFER_HPP
+#define TRIPLEBUFFER_HPP
+
+#include <atomic>
+
+/**
+ * @brief Three rotating copies of a value shared by one writer and one reader
+ * @details The writer owns the back copy and the reader owns the front copy; the third one sits
+ * in the middle. publish() swaps back and middle, acquire() swaps middle and front, each with a
+ * single atomic exchange. Neither side ever waits for the other, and the reader always sees a
+ * complete copy: the latest published one, or the one it already had.
+ * @tparam T Type of the shared value, reused between frames so its memory is kept
+ */
+template <typename T>
+class TripleBuffer {
+public:
+
+    /**
+     * @brief Get the copy the writer fills
+     */
+    T& back() { return mBuffers[mBack]; }
+
+    /**
+     * @brief Hand the back copy to the reader and take the middle one as the new back copy
+     * @details Called by the writer once the back copy is complete
+     */
+    void publish() {
+        mBack = mMiddle.exchange(mBack | NewFlag, std::memory_order_acq_rel) & IndexMask;
+    }
+
+    /**
+     * @brief Take the latest published copy as the front copy, if there is a new one
+     * @details Called by the reader before reading front()
+     * @return True if the front copy changed
+     */
+    bool acquire() {
+        if (!(mMiddle.load(std::memory_order_relaxed) & NewFlag)) {
+            return false;  ///< Nothing new, keep reading the same copy
+        }
+        mFront = mMiddle.exchange(mFront, std::memory_order_acq_rel) & IndexMask;
+        return true;
+    }
+
+    /**
+     * @brief Get the copy the reader uses
+     */
+    const T& front() const { return mBuffers[mFront]; }
+
+private:
+    /// Middle index bits, and the flag telling the reader it holds a copy it has not seen
+    static constexpr unsigned int IndexMask = 3;
+    static constexpr unsigned int NewFlag = 4;
+
+    /// The three copies
+    T mBuffers[3];
+
+    /// Index of the middle copy plus NewFlag, the only state both threads touch
+    std::atomic<unsigned int> mMiddle{1};
+
+    /// Index of the writer's copy, only touched by the writer
+    unsigned int mBack = 2;
+
+    /// Index of the reader's copy, only touched by the reader
+    unsigned int mFront = 0;
+};
+
+#endif // TRIPLEBUFFER_HPP
@@ -0,0 +1,255 @@
+/**
+ * @file AllocationTracker.cpp
+ * @brief AllocationTracker class implementation
+ * Replace the global operator new / delete (opt-in) and count allocations per frame and subsystem
+ */
+
+#include "AllocationTracker.hpp"
+#include "Logger.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+/// Display names, in AllocationTag order
+static const char* TagNames[] = { "other", "scene update", "boss patterns", "render", "dialogue" };
+static const int TagCount = static_cast<int>(AllocationTag::Count);
+
+/**
+ * @brief Get the display name of a tag (EX: "boss patterns")
+ */
+const char* AllocationTracker::getTagName(AllocationTag tag) {
+    return TagNames[static_cast<int>(tag)];
+}
+
+#ifdef OLDBOW_TRACK_ALLOCATIONS
+
+/// Allocations of the frame in progress, per tag
+struct AllocationCounter {
+    std::atomic<Uint64> allocations{0};
+    std::atomic<Uint64> bytes{0};
+};
+static AllocationCounter counters[TagCount];
+
+/// Tag of each thread, set by AllocationScope
+static thread_local AllocationTag currentTag = AllocationTag::Other;
+
+/// Session state, only touched by the thread that calls endFrame()
+static AllocationStats lastFrame[TagCount];
+static AllocationStats totals[TagCount];
+static Uint64 worstFrame[TagCount];        ///< Most allocations in a single frame
+static Uint64 framesAllocating[TagCount];  ///< Frames with at least one allocation
+static Uint64 frameIndex = 0;
+static bool sessionActive = false;
+static FILE* dumpFile = nullptr;
+
+/**
+ * @brief Count one allocation against the calling thread's tag
+ */
+static void countAllocation(std::size_t size) {
+    AllocationCounter& counter = counters[static_cast<int>(currentTag)];
+    counter.allocations.fetch_add(1, std::memory_order_relaxed);
+    counter.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Allocate with an alignment stricter than malloc's
+ */
+static void* alignedAllocate(std::size_t size, std::size_t alignment) {
+#ifdef _WIN32
+    return _aligned_malloc(size ? size : 1, alignment);
+#else
+    void* pointer = nullptr;
+    if (posix_memalign(&pointer, alignment < sizeof(void*) ? sizeof(void*) : alignment, size ? size : 1) != 0) {
+        return nullptr;
+    }
+    return pointer;
+#endif
+}
+
+/**
+ * @brief Free memory from alignedAllocate()
+ */
+static void alignedFree(void* pointer) {
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+/// Replaced global allocation functions: count, then allocate with malloc
+
+void* operator new(std::size_t size) {
+    countAllocation(size);
+    void* pointer = std::malloc(size ? size : 1);
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    countAllocation(size);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    countAllocation(size);
+    void* pointer = alignedAllocate(size, static_cast<std::size_t>(alignment));
+    if (!pointer) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    countAllocation(size);
+    return alignedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept {
+    return operator new(size, alignment, tag);
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { alignedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { alignedFree(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { alignedFree(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { alignedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { alignedFree(pointer); }
+
+/**
+ * @brief Set the tag of the calling thread
+ * @param tag New tag
+ * @return Previous tag
+ */
+AllocationTag AllocationTracker::setTag(AllocationTag tag) {
+    AllocationTag previous = currentTag;
+    currentTag = tag;
+    return previous;
+}
+
+/**
+ * @brief Start counting frames and open the dump file
+ * @details Allocations made before the session (start up) are dropped
+ * @param dumpPath CSV file written with one row per frame that allocated
+ */
+void AllocationTracker::beginSession(const char* dumpPath) {
+    for (int i = 0; i < TagCount; i++) {
+        counters[i].allocations.store(0, std::memory_order_relaxed);
+        counters[i].bytes.store(0, std::memory_order_relaxed);
+        lastFrame[i] = totals[i] = AllocationStats{};
+        worstFrame[i] = framesAllocating[i] = 0;
+    }
+    frameIndex = 0;
+    sessionActive = true;
+
+    dumpFile = std::fopen(dumpPath, "w");
+    if (!dumpFile) {
+        LOG_ERROR("Could not open allocation dump file: %s", dumpPath);
+        return;
+    }
+    std::fprintf(dumpFile, "frame");
+    for (int i = 0; i < TagCount; i++) {
+        std::fprintf(dumpFile, ",%s allocations,%s bytes", TagNames[i], TagNames[i]);
+    }
+    std::fprintf(dumpFile, "\n");
+}
+
+/**
+ * @brief Close the current frame: publish its counts and write them to the dump file
+ */
+void AllocationTracker::endFrame() {
+    if (!sessionActive) {
+        return;
+    }
+    bool allocated = false;
+    for (int i = 0; i < TagCount; i++) {
+        AllocationStats& frame = lastFrame[i];
+        frame.allocations = counters[i].allocations.exchange(0, std::memory_order_relaxed);
+        frame.bytes = counters[i].bytes.exchange(0, std::memory_order_relaxed);
+        totals[i].allocations += frame.allocations;
+        totals[i].bytes += frame.bytes;
+        if (frame.allocations > 0) {
+            framesAllocating[i]++;
+            allocated = true;
+        }
+        if (frame.allocations > worstFrame[i]) {
+            worstFrame[i] = frame.allocations;
+        }
+    }
+
+    /// Frames that allocated nothing are left out, so the file stays small once hot paths are clean
+    if (allocated && dumpFile) {
+        std::fprintf(dumpFile, "%llu", static_cast<unsigned long long>(frameIndex));
+        for (int i = 0; i < TagCount; i++) {
+            std::fprintf(dumpFile, ",%llu,%llu", static_cast<unsigned long long>(lastFrame[i].allocations),
+                         static_cast<unsigned long long>(lastFrame[i].bytes));
+        }
+        std::fprintf(dumpFile, "\n");
+    }
+    frameIndex++;
+}
+
+/**
+ * @brief Close the dump file and log a summary per tag
+ * @details The logger formats into fixed slots, so the summary allocates nothing itself
+ */
+void AllocationTracker::endSession() {
+    if (!sessionActive) {
+        return;
+    }
+    sessionActive = false;
+    if (dumpFile) {
+        std::fclose(dumpFile);
+        dumpFile = nullptr;
+    }
+    LOG_INFO("Allocations over %llu frames:", static_cast<unsigned long long>(frameIndex));
+    static_assert(TagCount <= static_cast<int>(Logger::MaxPerWindow), "one log line per tag must fit the rate limit");
+    for (int i = 0; i < TagCount; i++) {
+        LOG_INFO("  %s: %llu allocations, %llu KB, in %llu frames, worst frame %llu", TagNames[i],
+                 static_cast<unsigned long long>(totals[i].allocations),
+                 static_cast<unsigned long long>(totals[i].bytes / 1024),
+                 static_cast<unsigned long long>(framesAllocating[i]),
+                 static_cast<unsigned long long>(worstFrame[i]));
+    }
+}
+
+/**
+ * @brief Get the allocations of the last closed frame
+ * @param tag Subsystem
+ */
+AllocationStats AllocationTracker::getLastFrame(AllocationTag tag) {
+    return lastFrame[static_cast<int>(tag)];
+}
+
+#else
+
+/// Tracking not compiled in: nothing is counted
+
+AllocationTag AllocationTracker::setTag(AllocationTag) { return AllocationTag::Other; }
+void AllocationTracker::beginSession(const char*) {}
+void AllocationTracker::endFrame() {}
+void AllocationTracker::endSession() {}
+AllocationStats AllocationTracker::getLastFrame(AllocationTag) { return AllocationStats{}; }
+
+#endif // OLDBOW_TRACK_ALLOCATIONS
@@ -8,6 +8,12 @@
 
 #include "Application.hpp"
 #include "TimeManager.hpp"
+#include "InputQueue.hpp"
+#include "RenderStats.hpp"
+#include "ResourceManager.hpp"
+#include "AllocationTracker.hpp"
+#include "StartupTrace.hpp"
+#include "Logger.hpp"
 #include <SDL_ttf.h>
 #include <iostream>
 #include <cmath>
@@ -21,15 +27,22 @@ DialogueManager dialogueManager;
  */
 GameState currentState = GameState::Dialogue;
 
-/// Window dimensions
+/// Logical play field size: all gameplay coordinates, whatever the window or render resolution
 const int WINDOW_WIDTH = 1920;  // width
 const int WINDOW_HEIGHT = 1080; // height
 
+/// Longest sleep of an idle frame: loading dialogue lines and textures are picked up this often
+static const Uint32 IdleWaitMs = 100;
+
+/// Font of the dialogue text
+static const char* DialogueFontPath = "Assets/Merriweather.ttf";
+static const int DialogueFontSize = 24;
+
 /**
  * @brief Global flag to check if Application is exiting
  * Mainly used for destructor
  */
-bool isExiting = false;
+std::atomic<bool> isExiting{false};
 
 /**
  * @brief Initializes the application, including SDL, window, and renderer
@@ -40,25 +53,67 @@ Application::Application() : mWindow(nullptr), mRenderer(nullptr), currentColor(
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         throw std::runtime_error("SDL Initialization failed");
     }
+    StartupTrace::mark("SDL init");
+
+    /// Initialize SDL_ttf for text rendering
+    if (TTF_Init() == -1) {
+        throw std::runtime_error("TTF_Init failed");
+    }
+
+    /// The font does not need the renderer, rasterize it while the window and renderer are created
+    mFontThread = SDL_CreateThread(rasterizeFont, "FontLoader", this);
+    if (!mFontThread) {
+        SDL_Log("Could not start the font thread, rasterizing at start up: %s", SDL_GetError());
+    }
+    StartupTrace::mark("TTF init");
 
     /// Create window with SDL, throw an error if failed
-    mWindow = SDL_CreateWindow("SDL Window with Renderer", 20, 20, WINDOW_WIDTH, WINDOW_HEIGHT, 0);
+    mWindow = SDL_CreateWindow("SDL Window with Renderer", 20, 20, WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_RESIZABLE);
     if (!mWindow) {
+        joinFontThread();
         SDL_Quit();
         throw std::runtime_error("Window creation failed");
     }
+    StartupTrace::mark("window");
 
     /// Create renderer with SDL, throw an error if failed
     mRenderer = SDL_CreateRenderer(mWindow, -1, SDL_RENDERER_ACCELERATED);
     if (!mRenderer) {
+        joinFontThread();
         SDL_DestroyWindow(mWindow);
         SDL_Quit();
         throw std::runtime_error("Renderer creation failed");
     }
+    StartupTrace::mark("renderer");
 
-    /// Initialize SDL_ttf for text rendering
-    if (TTF_Init() == -1) {
-        throw std::runtime_error("TTF_Init failed");
+    /// Everything is drawn in play field coordinates, SDL maps them to the window (letterboxed)
+    SDL_RenderSetLogicalSize(mRenderer, WINDOW_WIDTH, WINDOW_HEIGHT);
+    mCompositor.init(mRenderer, WINDOW_WIDTH, WINDOW_HEIGHT);
+    StartupTrace::mark("render targets");
+
+    /// Only this thread talks to the renderer, the simulation thread uses preloaded textures
+    ResourceManager::setRenderThread();
+}
+
+/**
+ * @brief Font thread body: rasterize the dialogue font
+ * @param data The Application that owns the thread
+ */
+int Application::rasterizeFont(void* data) {
+    Application* self = static_cast<Application*>(data);
+    Uint64 start = SDL_GetPerformanceCounter();
+    self -> mFontRasterized = self -> mDialogueFont.rasterize(DialogueFontPath, DialogueFontSize);
+    self -> mFontMs = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+    return 0;
+}
+
+/**
+ * @brief Wait for the font thread, if it is running
+ */
+void Application::joinFontThread() {
+    if (mFontThread) {
+        SDL_WaitThread(mFontThread, nullptr);
+        mFontThread = nullptr;
     }
 }
 
@@ -84,8 +139,24 @@ void Application::startUp() {
     mScenes.push_back(scene2);
     mScenes.push_back(scene3);
 
-    /// Starts the current scene, default index 0
+    /// Starts the current scene, default index 0: only its opening dialogue is loaded now
     mScenes[currentScene] -> SceneStartUp(mRenderer);
+    StartupTrace::mark("scenes");
+
+    /// Upload the dialogue font rasterized during SDL start up, text is drawn from this atlas from now on
+    if (mFontThread) {
+        joinFontThread();
+        StartupTrace::record("font rasterize", mFontMs);
+    } else {
+        mFontRasterized = mDialogueFont.rasterize(DialogueFontPath, DialogueFontSize);
+    }
+    if (!mFontRasterized || !mDialogueFont.upload(mRenderer)) {
+        SDL_Log("Failed to load font!");
+    }
+    StartupTrace::mark("font");
+
+    recordSnapshot(mSnapshots.back());
+    mSnapshots.publish();
 }
 
 
@@ -96,12 +167,39 @@ void Application::startUp() {
 void Application::input(float deltaTime) {
     SDL_Event event;
 
+    /// Start a new frame of queued keyboard events
+    inputQueue.beginFrame(SDL_GetTicks());
+
     /// Poll for SDL events (user actions like key presses / releases)
     while (SDL_PollEvent(&event)) {
 
         /// Quit the application when the window close button is clicked
         if (event.type == SDL_QUIT) {
-            exit(0);
+            mQuitRequested = true;
+        }
+
+        /// F3 toggles the frame statistics overlay
+        if (event.type == SDL_KEYDOWN && !event.key.repeat && event.key.keysym.scancode == SDL_SCANCODE_F3) {
+            mOverlay.toggle();
+            mRedraw = true;
+        }
+
+        /// The renderer lost the contents of its targets (EX: device reset), redraw the layers
+        if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
+            mCompositor.invalidate();
+            mRedraw = true;
+        }
+
+        /// The window contents were lost or resized, an idle screen has to be presented again
+        if (event.type == SDL_WINDOWEVENT &&
+            (event.window.event == SDL_WINDOWEVENT_EXPOSED || event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED ||
+             event.window.event == SDL_WINDOWEVENT_RESTORED || event.window.event == SDL_WINDOWEVENT_SHOWN)) {
+            mRedraw = true;
+        }
+
+        /// Queue key presses / releases with their timestamps for the simulation to replay
+        if (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) {
+            inputQueue.push(event.key);
         }
 
         /// Handle mouse click events for dialogue progression
@@ -129,38 +227,63 @@ void Application::update(float deltaTime) {
 }
 
 /**
- * @brief Renders game entities through the scene class for each scene,
+ * @brief Renders the game entities recorded in a frame snapshot,
  * render the dialogue box during dialogue state
+ * @details Only reads the snapshot, so it is safe to run while the next frame is simulated
+ * @param frame Snapshot of the frame to draw
  */
-void Application::render() {
-    if (dialogueManager.getCurrentBackground()) {
-        SDL_RenderCopy(mRenderer, dialogueManager.getCurrentBackground().get(), nullptr, nullptr);
-    }
-    /// Handle drawing game entities for each scene
-    mScenes[currentScene] -> render(mRenderer);
+void Application::render(const FrameSnapshot& frame) {
+    /// Background and gameplay layers, redrawn only where they changed
+    mCompositor.composite(mRenderer, frame, mScaler.getScale());
 
     /**
      * @brief When player reached the Dialogue / Victory / Defeat state, render text,
      * render a transparent text box to enhance text
      */
-    if (currentState == GameState::Dialogue ||
-        currentState == GameState::Victory ||
-        currentState == GameState::Defeat) {
+    if (frame.state == GameState::Dialogue ||
+        frame.state == GameState::Victory ||
+        frame.state == GameState::Defeat) {
 
         /// If dialogue manager is done reading, keep rendering
-        if (!dialogueManager.isFinished()) {
+        if (frame.showDialogue) {
             SDL_Rect backgroundRect = { 50, 850, 1800, 200 }; // text box size
             SDL_SetRenderDrawColor(mRenderer, 40, 40, 40, 220); // transparent
             SDL_RenderFillRect(mRenderer, &backgroundRect);
-            std::string text = dialogueManager.getCurrentLine();
-            if (!text.empty()) {
-                renderText(text, 100, 900);  // Adjust location of texts
+            RenderStats::drawCalls++;
+            if (!frame.dialogueLine.empty()) {
+                renderText(frame.dialogueLine, 100, 880, backgroundRect.w - 100);  // Adjust location of texts
             }
         }
 
     }
-    /// Push everything to screen
-    SDL_RenderPresent(mRenderer);
+
+    /// Frame statistics overlay goes on top of everything
+    mOverlay.render(mRenderer, frame.counts, frame.fireLatency);
+}
+
+/**
+ * @brief Record the current scene, dialogue and UI state into a snapshot
+ * @param snapshot Snapshot to fill
+ */
+void Application::recordSnapshot(FrameSnapshot& snapshot) {
+    mScenes[currentScene] -> buildSnapshot(snapshot);
+    snapshot.fireLatency = inputQueue.getAverageFireLatency();
+
+    /// Copy the dialogue line, the renderer must not read the dialogue manager itself
+    snapshot.dialogueBackground = dialogueManager.getCurrentBackground().get();
+    snapshot.showDialogue = !dialogueManager.isFinished();
+    if (snapshot.showDialogue) {
+        snapshot.dialogueLine = dialogueManager.getCurrentLine();
+    }
+}
+
+/**
+ * @brief Check if a snapshot shows what is already on screen
+ * @param frame Snapshot to compare
+ */
+bool Application::isShown(const FrameSnapshot& frame) const {
+    return frame.state == mShownState && frame.dialogueBackground == mShownBackground &&
+           frame.showDialogue == mShownDialogue && (!frame.showDialogue || frame.dialogueLine == mShownLine);
 }
 
 /**
@@ -168,13 +291,11 @@ void Application::render() {
  * @param TargetFPS Target frames per second for the game loop
  */
 void Application::loop(int TargetFPS) {
-    /// Calculate the time budget for each frame based on the target FPS
-    Uint32 budgetTime = 1000 / TargetFPS;
+    /// The frame pacer holds an exact frame period (16.67 ms at 60 FPS, not 16 ms)
+    mFramePacer.setTargetFPS(TargetFPS);
 
     /// Initialize all time variables
-    Uint32 startTime, elapsedTime;           // Marks start time for a frame (startTime), Stores time spent to finish a frame
-    Uint32 frameEnd = SDL_GetTicks();        // Marks end time when a frame is finished
-    Uint32 lastFPSTime = SDL_GetTicks();     // Marks the last time a minute has passed
+    Uint32 lastFPSTime = SDL_GetTicks();     // Marks the last time a second has passed
     /**
      * @brief Marks the last time a frame has been finished, used to calculate deltaTime,
      * @details Value is stored in TimeManager class to control deltaTime calculation for other classes,
@@ -182,16 +303,25 @@ void Application::loop(int TargetFPS) {
      * @example
      * // When switching to a new scene, reset deltaTime to prevent sudden enemy movement / false placement
      */
-    TimeManager::lastUpdateTime = SDL_GetTicks();
+    TimeManager::resetLastUpdateTime();
     int frameCount = 0;                     // Marks how many frames has been drawn, used to count FPS (frame per second)
+    bool firstFrame = true;
+    mFramePacer.start();
+    AllocationTracker::beginSession("allocations.csv");  ///< No-op unless built with -DOLDBOW_TRACK_ALLOCATIONS
 
-    /// Keep running until all scenes are done
-    while (currentScene < mScenes.size()) {
+    /// Keep running until all scenes are done or the window is closed
+    while (!mQuitRequested && currentScene < static_cast<int>(mScenes.size())) {
         /// If current scene is inactive, move to the next one
         if (!mScenes[currentScene] -> GetSceneStatus()) {
+            /// Free everything the finished scene allocated before starting the next one
+            mScenes[currentScene] -> SceneShutDown();
             currentScene++;
-            if (currentScene < mScenes.size()) {
+            if (currentScene < static_cast<int>(mScenes.size())) {
                 mScenes[currentScene] -> SceneStartUp(mRenderer);
+                mCompositor.invalidate();  ///< The new background may reuse the old one's address
+                mRedraw = true;
+                recordSnapshot(mSnapshots.back());  // Nothing of the old scene is shown
+                mSnapshots.publish();
             } else {
                 std::cout << "Thank you for playing.\n";
                 /// Stop game loop / Quit
@@ -199,88 +329,202 @@ void Application::loop(int TargetFPS) {
             }
         }
 
-        /// Get the time at the start of the current frame
-        startTime = SDL_GetTicks();
+        /**
+         * @brief Idle frame: nothing on screen changes without input, so sleep until an event arrives
+         * @details Dialogue and end screens only change on a click, a window event or when loading
+         * finishes. The wait is not simulated time and is left out of the frame statistics.
+         */
+        bool idle = mIdle;
+        if (idle) {
+            SDL_WaitEventTimeout(nullptr, IdleWaitMs);  ///< Leaves the event in the queue for input()
+            TimeManager::resetLastUpdateTime();
+        }
 
-        /// Calculate deltaTime (time elapsed since the last update) and convert to seconds
-        float deltaTime = (startTime - TimeManager::lastUpdateTime) / 1000.0f; // Convert to Seconds by dividing 1000
-        TimeManager::resetLastUpdateTime();  // Reset lastUpdateTime for next frame and prepare for deltaTime calculation
+        /// Get the time at the start of the current frame (high resolution counter)
+        Uint64 startTime = SDL_GetPerformanceCounter();
+        RenderStats::drawCalls = 0;
+
+        /// Calculate deltaTime (time elapsed since the last update) in seconds
+        float deltaTime = TimeManager::getDeltaTime(startTime);
+        TimeManager::lastUpdateTime = startTime;  // Prepare for the next deltaTime calculation
 
         /**
         * @brief Main Game Loop input(),
         * Trigger all functions / behaviors related to user input
         */
-        input(deltaTime);
+        {
+            AllocationScope tag(AllocationTag::SceneUpdate);
+            input(deltaTime);
+        }
+        if (mQuitRequested) {
+            break;
+        }
 
         /**
-        * @brief Main Game Loop update(),
-        * update all game entities, check collisions and others
+        * @brief Main Game Loop update(), on the simulation thread
+        * update all game entities, check collisions and others, then record the next snapshot
         * update is prevented in dialogue state
         */
-        if (currentState != GameState::Dialogue) {
-            update(deltaTime);
-        }
+        mSimulation.start([this, deltaTime]() {
+            Uint64 simulationStart = SDL_GetPerformanceCounter();
+            if (currentState != GameState::Dialogue) {
+                AllocationScope tag(AllocationTag::SceneUpdate);
+                update(deltaTime);
+            }
+            FrameSnapshot& next = mSnapshots.back();
+            {
+                AllocationScope tag(AllocationTag::Render);
+                recordSnapshot(next);
+            }
+            next.simulationMs = (SDL_GetPerformanceCounter() - simulationStart) * 1000.0 / SDL_GetPerformanceFrequency();
+            mLastSimulationMs = next.simulationMs;
+            mSnapshots.publish();
+        });
+        Uint64 renderStart = SDL_GetPerformanceCounter();
 
         /**
         * @brief Main Game Loop render(),
-        * render all updated game entities and text to the screen
+        * meanwhile render the latest published snapshot and text to the screen
         */
-        render();
+        Uint64 renderEnd = renderStart, presentEnd = renderStart;
+        mSnapshots.acquire();
+        bool draw = !idle || mRedraw || !isShown(mSnapshots.front());
+        if (draw) {
+            AllocationScope tag(AllocationTag::Render);
+            const FrameSnapshot& frame = mSnapshots.front();
+            render(frame);
+            renderEnd = SDL_GetPerformanceCounter();
+
+            /// Push everything to screen
+            SDL_RenderPresent(mRenderer);
+            presentEnd = SDL_GetPerformanceCounter();
+            frameCount++; // One frame has been presented
+
+            mRedraw = false;
+            mShownState = frame.state;
+            mShownBackground = frame.dialogueBackground;
+            mShownDialogue = frame.showDialogue;
+            mShownLine = frame.dialogueLine;
+        }
+
+        /// Start up ends with the first frame that shows the opening dialogue (or the battle, if it has none)
+        if (draw && !StartupTrace::isFinished()) {
+            const FrameSnapshot& shown = mSnapshots.front();
+            if (shown.state != GameState::Dialogue || !shown.dialogueLine.empty()) {
+                StartupTrace::finish("opening dialogue");
+            } else if (firstFrame) {
+                StartupTrace::mark("first frame");
+            }
+        }
+        firstFrame = false;
+
+        /// Join the simulation and run what it left for the main thread (mostly dialogue loading)
+        mSimulation.wait();
+        {
+            AllocationScope tag(AllocationTag::Dialogue);
+            mScenes[currentScene] -> runMainThreadJobs();
+            dialogueManager.update();  ///< Streamed dialogue lines and prefetched backgrounds
+        }
+        int uploaded = ResourceManager::uploadDecoded(mRenderer, 1);  ///< Battle textures decoded while the dialogue plays
 
-        /// Mark the time when the current frame ends
-        frameEnd = SDL_GetTicks();
-        /// Time spent processing this frame
-        elapsedTime = frameEnd - startTime;
-        frameCount++; // One frame has passed
+        /// Every thread is done with this frame, close its allocation counts
+        AllocationTracker::endFrame();
 
-        /// Update the window title every second to show FPS
-        if (startTime - lastFPSTime >= 1000) {
+        /// Update the window title every second to show FPS and input-to-fire latency
+        Uint32 currentTicks = SDL_GetTicks();
+        if (currentTicks - lastFPSTime >= 1000) {
             std::string title = "Old Bow - FPS: " + std::to_string(frameCount);
+            if (inputQueue.getAverageFireLatency() >= 0.0f) {
+                title += " - Input-to-fire: " + std::to_string(static_cast<int>(std::lround(inputQueue.getAverageFireLatency()))) + " ms";
+            }
             SDL_SetWindowTitle(mWindow, title.c_str());
-            frameCount = 0;          // Reset frame count after each second
-            lastFPSTime = startTime; // Update lastFPSTime to the current time
+            frameCount = 0;             // Reset frame count after each second
+            lastFPSTime = currentTicks; // Update lastFPSTime to the current time
+        }
+
+        /**
+         * @brief Go idle once the screen has settled: outside of battle, nothing loading,
+         * and the frame just simulated shows what is already presented
+         */
+        mIdle = false;
+        if (currentState != GameState::Playing && !mOverlay.isVisible() && !mRedraw &&
+            !dialogueManager.isLoading() && uploaded == 0) {
+            mSnapshots.acquire();
+            mIdle = isShown(mSnapshots.front());
+        }
+        if (idle) {
+            mFramePacer.start();  ///< The next paced frame starts now, not when the idle wait began
+            continue;
         }
 
-        /// Delay if the frame was processed faster than the target frame time (to maintain constant FPS)
-        if (elapsedTime < budgetTime) {
-            SDL_Delay(budgetTime - elapsedTime);
+        /// Sleep / spin until the next frame deadline (to maintain constant FPS)
+        mFramePacer.waitForNextFrame();
+
+        /// Feed the overlay with the stage timings of the finished frame
+        FrameTiming timing;
+        double ticksToMs = 1000.0 / SDL_GetPerformanceFrequency();
+        timing.frameMs = mFramePacer.getLastFrameTime();
+        timing.updateMs = mLastSimulationMs;  ///< Overlaps render and present
+        timing.renderMs = (renderEnd - renderStart) * ticksToMs;
+        timing.presentMs = (presentEnd - renderEnd) * ticksToMs;
+        timing.drawCalls = RenderStats::drawCalls;
+        timing.renderScale = mCompositor.getScale();
+        mOverlay.recordFrame(timing);
+        if (mCompositor.isScalable()) {
+            mScaler.recordFrame(timing, mFramePacer.getFramePeriod());
         }
     }
+
+    AllocationTracker::endSession();
+
+    /// Report how evenly frames were paced over the whole session
+    const FrameTimeHistogram& histogram = mFramePacer.getHistogram();
+    LOG_INFO("Frame time over %u frames: mean %.2f ms, p50 %.2f ms, p99 %.2f ms", histogram.getCount(),
+             histogram.getMean(), histogram.getPercentile(50), histogram.getPercentile(99));
 }
 
 /**
- * @brief Renders text to the screen at ta specified location
+ * @brief Enable or disable presenting with vsync
+ * @details Queries the display refresh rate so the frame pacer can line frames up with vblank
+ * @param enabled True to wait for vsync in SDL_RenderPresent
+ */
+void Application::setVSync(bool enabled) {
+    if (SDL_RenderSetVSync(mRenderer, enabled ? 1 : 0) != 0) {
+        SDL_Log("Failed to change vsync: %s", SDL_GetError());
+        enabled = false;
+    }
+    SDL_DisplayMode mode;
+    int refreshRate = 0;
+    if (SDL_GetWindowDisplayMode(mWindow, &mode) == 0) {
+        refreshRate = mode.refresh_rate;
+    }
+    mFramePacer.setVSync(enabled, refreshRate);
+}
+
+/**
+ * @brief Renders word wrapped text to the screen at a specified location
+ * @details Lines are laid out from the glyph atlas only when the message changes,
+ * every other frame reuses the cached quads
  * @param message The text message to render
  * @param x The x coordinate to start rendering the text
  * @param y The y coordinate to start rendering the text
+ * @param maxWidth Width at which lines are wrapped
  */
-void Application::renderText(const std::string& message, int x, int y) {
-    /// Load text font from file
-    TTF_Font* font = TTF_OpenFont("Assets/Merriweather.ttf", 24);
-    if (!font) {
-        SDL_Log("Failed to load font!");
+void Application::renderText(const std::string& message, int x, int y, int maxWidth) {
+    if (!mDialogueFont.isReady()) {
         return;
     }
 
-    /// Create text surface
-    SDL_Color color = { 255, 255, 255, 255 }; // white color text
-    /// Render the given text into an SDL surface using the specified font and color
-    SDL_Surface* surface = TTF_RenderText_Solid(font, message.c_str(), color);
-    if (!surface) {
-        SDL_Log("Failed to create text surface: %s", TTF_GetError());
-        return;
+    /// Lay the message out again only when it changed
+    if (message != mCachedLine || mLineVertices.empty()) {
+        mCachedLine = message;
+        mLineVertices.clear();
+        mLineIndices.clear();
+        SDL_Color color = { 255, 255, 255, 255 }; // white color text
+        mDialogueFont.appendWrappedText(mLineVertices, mLineIndices, message,
+                                        static_cast<float>(x), static_cast<float>(y), maxWidth, color);
     }
-    /// Convert the surface to a texture so that GPU can handle this part
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(mRenderer, surface);
-
-    /// Set location for text then render
-    SDL_Rect dstRect = { x, y, surface -> w, surface -> h };
-    SDL_RenderCopy(mRenderer, texture, nullptr, &dstRect);
-
-    /// clean all resources
-    SDL_FreeSurface(surface);
-    SDL_DestroyTexture(texture);
-    TTF_CloseFont(font);
+    mDialogueFont.draw(mRenderer, mLineVertices, mLineIndices);
 }
 
 /**
@@ -293,15 +537,15 @@ Application::~Application() {
      * signal other associated classes to clean up
      */
     isExiting = true;
+    joinFontThread();
+    mOverlay.shutDown();
+    mCompositor.shutDown();
+    mDialogueFont.release();
+    dialogueManager.shutDown();
+    ResourceManager::shutDown();
     SDL_DestroyRenderer(mRenderer);
     SDL_DestroyWindow(mWindow);
 
     ///Clean up SDL subsystems
     SDL_Quit();
-    for (auto& scene : mScenes) {
-        if (scene -> backgroundTexture) {
-            SDL_DestroyTexture(scene -> backgroundTexture);
-            scene -> backgroundTexture = nullptr;
-        }
-    }
 }
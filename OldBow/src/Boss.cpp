@@ -6,11 +6,11 @@
  */
 
 #include "Boss.hpp"
-#include <iostream>
+#include <algorithm>
 #include <random>
-#include <fstream>
-#include <sstream>
 #include "Collision2DComponent.hpp"
+#include "AllocationTracker.hpp"
+#include "Logger.hpp"
 
 std::random_device rd;
 std::mt19937 gen(rd());
@@ -33,7 +33,7 @@ Boss::Boss(SDL_Renderer* renderer) :
     mGhostFireRate = 5.0f;
     mSlashFireRate = 7.0f;
 
-    /// Initialize cooldowns (to fire immediately on scene start)
+    /// Initialize first shot delays (0 to fire immediately on scene start)
     mRainCooldown = 0.0f;
     mSpreadCooldown = 0.0f;
     mGhostFireCooldown = 0.0f;
@@ -48,9 +48,6 @@ Boss::Boss(SDL_Renderer* renderer) :
     /// Fire period: How long the Ultimate attack last in general
     mUltimateFirePeriodDefault = 5.0f;
 
-    /// Fire period timer: How long the FIRST Ultimate attack should last
-    mUltimateFirePeriodTimer = 5.0f;
-
     /// Size of the Ultimate projectiles
     mUltimateProjectileHeight = 24.0f;
     mUltimateProjectileWidth = 24.0f;
@@ -65,28 +62,10 @@ void Boss::setPlayerReference(std::shared_ptr<Player> player) {
     mPlayer = player;
 }
 
-/**
- * @brief Utility function to trim leading spaces from a string
- * @details Scans the input string and returns a new string without leading spaces.
- * If no non-space character is found, returns an empty string.
- * @param str Input string to be trimmed
- * @return Trimmed string without leading spaces
- */
-static std::string trim(const std::string& str) {
-    // size_t for non-negative value
-    size_t first = str.find_first_not_of(' ');  // retrieve the first index found that isn't a space
-    /**
-     * @brief if first returned "npos" (nothing found), return empty string,
-     * otherwise return the substring of the original string starting from index found that isn't a space
-     */
-    return (first == std::string::npos) ? "" : str.substr(first);
-}
-
-
 /**
  * @brief Load boss configuration from file
- * @details Parses boss attributes and attack patterns from a text file
- * Each line in the file follows the format: "Key: Value"
+ * @details Reads the boss definition through CompiledAssets, which prefers the compiled
+ * ".bin" blob and falls back to parsing the "Key: Value" text file in dev builds.
  * Supported keys:
  * - ID: Identifier of the boss (Boss1, Boss2, Boss3)
  * - Name: Name of the boss
@@ -97,99 +76,64 @@ static std::string trim(const std::string& str) {
  * @param filePath Path to the boss configuration file
  */
 void Boss::loadFromFile (const std::string& filePath) {
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
-        std::cerr << "ERROR: Could not open boss file: " << filePath << std::endl;
+    CompiledAssets::BossDefinition definition;
+    if (!CompiledAssets::loadBoss(filePath, definition)) {
+        LOG_ERROR("Could not load boss file: %s", filePath.c_str());
         return;
     }
-    std::string line;
-    while (std::getline(file, line)) {
-        /**
-        * @brief find the ":" that separates the key and value
-        * @example key = "Name"
-        * @example value = "Boss1"
-        */
-        size_t separatorPos = line.find(":");
-        if (separatorPos == std::string::npos) {
-            continue;  // Ignore lines that are not key - value based
-        }
 
-        /// start from index 0, end before index where separator (":") found
-        std::string key = trim(line.substr(0, separatorPos));
-
-        /// start after the separator, continue until the end of string
-        std::string value = trim(line.substr(separatorPos + 1));
-
-        /// Parse configuration key-value pairs
-        if (key == "ID") {
-            /// Assign boss ID based on string value
-            if (value == "Boss1") {
-                mID = BossID::Boss1;
-            } else if (value == "Boss2") {
-                mID = BossID::Boss2;
-            } else if (value == "Boss3") {
-                mID = BossID::Boss3;
-            }
-        } else if (key == "Name") {
-            /// Store boss name
-            mName = value;
-        } else if (key == "HP") {
-            /// Set boss health points
-            mHP = std::stoi(value);
-            mMaxHP = mHP;
-        } else if (key == "ID") {
-
-        } else if (key == "PatternList") {
-            /// Split pattern list by commas
-            std::stringstream container(value);
-            /// Temporary variable to store each extracted pattern(extracted value)
-            std::string pattern;
-
-            /// Extract tokens from stringstream (container), split by ","
-            while (std::getline(container, pattern, ',')) {
-                // Clean up leading spaces with trim()
-                pattern = trim(pattern);
-
-                /// Map string pattern to enum type
-                if (pattern == "Rain") {
-                    mPatternList.push_back(PatternType::Rain);
-                } else if (pattern == "Spread") {
-                    mPatternList.push_back(PatternType::Spread);
-                } else if (pattern == "Ultimate") {
-                    mPatternList.push_back(PatternType::Ultimate);
-                } else if (pattern == "Ghost") {
-                    mPatternList.push_back(PatternType::GhostFire);
-                } else if (pattern == "Slash") {
-                    mPatternList.push_back(PatternType::Slash);
-                } else {
-                    std::cerr << "Failure! Unknown pattern type: " << pattern << std::endl;
-                }
-            }
-        } else if (key == "Texture") {
-            /// Set the texture file path
-            mTexturePath = value;
-        }
-    }
+    applyDefinition(definition);
+}
+
+/**
+ * @brief Apply a loaded boss configuration
+ * @param definition Boss definition (EX: kept by a scene checkpoint)
+ */
+void Boss::applyDefinition(const CompiledAssets::BossDefinition& definition) {
+    mID = definition.id;
+    mName = definition.name;
+    mHP = definition.hp;
+    mMaxHP = mHP;
+    mPatternList = definition.patterns;
+    mTexturePath = definition.texturePath;
 
     /// Warn if no texture path was provided
     if (mTexturePath.empty()) {
-        std::cerr << "WARNING! No texture path set for boss!\n";
+        LOG_WARNING("No texture path set for boss %s", mName.c_str());
     }
 }
 
 
+/**
+ * @brief Get the configuration the boss was loaded with
+ * @return Boss definition, its hp is the maximum HP
+ */
+CompiledAssets::BossDefinition Boss::getDefinition() const {
+    CompiledAssets::BossDefinition definition;
+    definition.id = mID;
+    definition.name = mName;
+    definition.hp = mMaxHP;
+    definition.patterns = mPatternList;
+    definition.texturePath = mTexturePath;
+    return definition;
+}
+
+/**
+ * @brief Random engine driving boss direction changes
+ */
+std::mt19937& Boss::directionEngine() {
+    return gen;
+}
+
+
 /**
  * @brief Update boss state every frame
- * @details Handles boss movement, cooldowns, attack patterns, and projectile updates.
+ * @details Handles boss movement, the ultimate fire period, and projectile updates.
+ * Attack patterns are fired by the scene's timer wheel (see startTimers).
  * Also processes random direction changes and cleans up inactive projectiles.
  * @param deltaTime Time elapsed since last frame (in seconds)
  */
 void Boss::update(float deltaTime) {
-    /// Update all boss components
-    for (auto& component : mComponents) {
-        component.second->update(deltaTime);
-    }
-
     /// Retrieve the transform component of boss
     auto ref = GetTransform();
     if (!ref) {
@@ -243,82 +187,113 @@ void Boss::update(float deltaTime) {
     /// Apply calculated movement to boss transform
     ref -> move(nextX, nextY);
 
-    /**
-     * @brief Reduce the cooldown timers by time spent for each frame
-     * @example: Firerate is 0.5, then Cooldown = 0.5 - 0.016 (60FPS)
-     */
-    mRainCooldown -= deltaTime;
-    mSpreadCooldown -= deltaTime;
-    mUltimateTimer -= deltaTime;
-    mGhostFireCooldown -= deltaTime;
-    mSlashCooldown -= deltaTime;
-
-    /// Skip update if pattern list is empty
-    if (mPatternList.empty()) {
-        return;
+    /// Dragon Breath fires every frame of an ultimate fire period
+    if (mUltimateFiring) {
+        AllocationScope tag(AllocationTag::BossPatterns);
+        dragonBreath();
     }
 
+    /// Update all active boss projectiles
+    mProjectiles.update(deltaTime);
 
-    /// Process active attack patterns when cooldown(timer) reaches and below 0
-    for (PatternType pattern : mPatternList) {
-        switch (pattern) {
+    /// Clean up inactive projectiles
+    mProjectiles.removeInactive();
+}
 
+
+/**
+ * @brief Register the attack patterns and the ultimate on the scene's timer wheel
+ * @details Each pattern of the list gets one repeating timer, starting after its first shot delay.
+ * The ultimate alternates between a fire period and its cooldown.
+ * @param timers Timer wheel of the scene
+ */
+void Boss::startTimers(TimerWheel& timers) {
+    for (size_t i = 0; i < mPatternList.size(); i++) {
+        PatternType pattern = mPatternList[i];
+        /// A pattern listed twice still fires at its own rate
+        if (std::find(mPatternList.begin(), mPatternList.begin() + i, pattern) != mPatternList.begin() + i) {
+            continue;
+        }
+        switch (pattern) {
             case PatternType::Rain:
-                if (mRainCooldown <= 0.0f) {
-                    fireStraightRain();
-                    mRainCooldown = mRainFireRate;
-                }
+                schedulePattern(timers, pattern, mRainCooldown);
                 break;
-
             case PatternType::Spread:
-                if (mSpreadCooldown <= 0.0f) {
-                    fireSpreadShot();
-                    mSpreadCooldown = mSpreadFireRate;
-                }
+                schedulePattern(timers, pattern, mSpreadCooldown);
                 break;
-
-            /// Special logic: Ultimate cooldown is controlled by timer, fire rate is used for burst shots
             case PatternType::Ultimate:
-                if (mUltimateTimer <= 0.0f) {
-                    dragonBreath();
-                    mUltimateFirePeriodTimer -= deltaTime;
-                    if (mUltimateFirePeriodTimer <= 0.0f) {
-                        mUltimateTimer = mUltimateCooldown;
-                        resetUltFirePeriod();
-                    }
-                };
+                scheduleUltimate(timers, true, mUltimateTimer);
                 break;
-
             case PatternType::GhostFire:
-                if (mGhostFireCooldown <= 0) {
-                    fireLingeringGhostShot();
-                    mGhostFireCooldown = mGhostFireRate;
-                }
+                schedulePattern(timers, pattern, mGhostFireCooldown);
                 break;
-
             case PatternType::Slash:
-                if (mSlashCooldown <= 0) {
-                    slash();
-                    mSlashCooldown = mSlashFireRate;
-                }
+                schedulePattern(timers, pattern, mSlashCooldown);
+                break;
         }
     }
+}
 
-
-
-    /// Update all active boss projectiles
-    for (auto& proj : mProjectiles) {
-        proj -> update(deltaTime);
+/**
+ * @brief Fire one attack pattern
+ * @param pattern Pattern to fire
+ * @return Delay before the pattern fires again (in seconds)
+ */
+float Boss::firePattern(PatternType pattern) {
+    AllocationScope tag(AllocationTag::BossPatterns);
+    switch (pattern) {
+        case PatternType::Rain:
+            fireStraightRain();
+            return mRainFireRate;
+        case PatternType::Spread:
+            fireSpreadShot();
+            return mSpreadFireRate;
+        case PatternType::GhostFire:
+            fireLingeringGhostShot();
+            return mGhostFireRate;
+        case PatternType::Slash:
+            slash();
+            return mSlashFireRate;
+        default:
+            return mUltimateCooldown;  ///< The ultimate is driven by scheduleUltimate
     }
+}
 
-    /// Clean up inactive projectiles
-    for (auto it = mProjectiles.begin(); it != mProjectiles.end();) {
-        if (!(*it)->getRenderable()) {
-            it = mProjectiles.erase(it);
-        } else {
-            ++it;
+/**
+ * @brief Schedule the next shot of an attack pattern
+ * @details The callback only holds a weak reference, a destroyed boss' timer fires once and is dropped
+ * @param timers Timer wheel of the scene
+ * @param pattern Pattern to fire
+ * @param delay Delay before the shot (in seconds)
+ */
+void Boss::schedulePattern(TimerWheel& timers, PatternType pattern, float delay) {
+    std::weak_ptr<Boss> self = std::static_pointer_cast<Boss>(shared_from_this());
+    timers.schedule(delay, [self, &timers, pattern]() {
+        std::shared_ptr<Boss> boss = self.lock();
+        if (!boss || !boss -> getRenderable()) {
+            return;  // Dead bosses stop firing
         }
-    }
+        boss -> schedulePattern(timers, pattern, boss -> firePattern(pattern));
+    });
+}
+
+/**
+ * @brief Schedule the next start or end of the ultimate fire period
+ * @param timers Timer wheel of the scene
+ * @param firing State the ultimate switches to
+ * @param delay Delay before the switch (in seconds)
+ */
+void Boss::scheduleUltimate(TimerWheel& timers, bool firing, float delay) {
+    std::weak_ptr<Boss> self = std::static_pointer_cast<Boss>(shared_from_this());
+    timers.schedule(delay, [self, &timers, firing]() {
+        std::shared_ptr<Boss> boss = self.lock();
+        if (!boss || !boss -> getRenderable()) {
+            return;
+        }
+        boss -> mUltimateFiring = firing;
+        /// Fire period ends after its duration, the next one starts after the cooldown
+        boss -> scheduleUltimate(timers, !firing, firing ? boss -> mUltimateFirePeriodDefault : boss -> mUltimateCooldown);
+    });
 }
 
 
@@ -344,53 +319,25 @@ void Boss::fireStraightRain() {
     /// Define total number of projectiles and total range of attack (in width sense)
     int numProjectiles = 7;
     float totalAttackWidth = 800.0f;  // total range of attack
-    float spacing;
-    if (numProjectiles > 1) {
-        spacing = totalAttackWidth / (numProjectiles - 1);  ///< Even spacing between projectiles
-    }
-
-    /// Calculate starting X position to center projectile
-    float startX = x + (transform -> getWidth() / 2.0f) - (totalAttackWidth / 2.0f);
 
     /**
-     * @brief Create all projectiles for this fire pattern
-     * @details Assign texture, movement type, start position and size for each projectile,
-     * and store them into the boss projectile vector
+     * @brief Launch the whole row upward(true) in one volley
+     * @details Projectiles are evenly spaced, centered under the boss and spawned slightly below it
+     * (boss size + margin of 10). This fire pattern launches upward,
+     * then strike downward when the top of screen is reached
      */
-    for (int i = 0; i < numProjectiles; i++) {
-        float projX = startX + spacing * i;
-
-        std::shared_ptr<Projectile> projectile = std::make_shared<Projectile>(mRenderer);
-        projectile -> setIsPlayerProjectile(false);
-        projectile -> setIsBossProjectile(true);
-        projectile -> init();
-
-        projectile -> setProjectileMovementType(ProjectileMovementType::UpDown);
-
-        /// Create texture
-        std::shared_ptr<TextureComponent> bossProjectileTexture = std::make_shared<TextureComponent>();
-        bossProjectileTexture -> CreateTextureComponent(mRenderer, "Assets/EvilSpikes.bmp");
-        projectile -> AddComponent(bossProjectileTexture);
-
-        /// Set projectile size
-        auto projTransform = projectile -> GetTransform();
-        projTransform -> setWidth(60.0f);
-        projTransform -> setHeight(60.0f);
-
-        projTransform -> setRotation(180.0f); ///< Rotate projectile once to face downward
-        if (projTransform) {
-            projTransform -> move(projX, y + 310); ///< Spawn slightly below the boss (boss size + margin of 10)
-        }
-
-        /**
-        * @brief Activate the projectile and launch upward(true)
-        * @details This fire pattern launches upward,
-        * then strike downward when the top of screen is reached
-        */
-        projectile -> Launch(projX, y, true); // false = move downward, true = move upward
-
-        mProjectiles.push_back(projectile);
-    }
+    VolleyDesc volley;
+    volley.count = numProjectiles;
+    volley.originX = x + (width / 2.0f) - (totalAttackWidth / 2.0f);
+    volley.originY = y + 310;
+    volley.spacingX = totalAttackWidth / (numProjectiles - 1);  ///< Even spacing between projectiles
+    volley.movement = ProjectileMovementType::UpDown;
+    volley.upward = true;
+    volley.sprite = "Assets/EvilSpikes.bmp";
+    volley.width = 60.0f;
+    volley.height = 60.0f;
+    volley.rotation = 180.0f;  ///< Rotate projectiles once to face downward
+    Projectile::spawnVolley(volley, mRenderer, mProjectiles);
 }
 
 
@@ -418,33 +365,21 @@ void Boss::fireSpreadShot() {
     /// Base angle adjustment for inverted Y-axis (for boss projectiles, positive Y means downward)
     float offset = -90.0f;
 
-    /// Prepare list of firing angles (from -90 to 90 degrees, every 15 degrees)
-    std::vector<float> angles;
-    for (float angle = -90.0f; angle <= 90.0f; angle += 15.0f) {
-        angles.push_back(angle - offset);
-    }
-
-
-    /// Spawn projectiles at calculated angles
-     for (float angle : angles) {
-        std::shared_ptr<Projectile> projectile = std::make_shared<Projectile>(mRenderer);
-        projectile -> setIsPlayerProjectile(false);
-        projectile -> setIsBossProjectile(true);
-        projectile -> init();
-        /// Set the projectile's movement type to Angle type(more flexible movement
-        projectile -> setProjectileMovementType(ProjectileMovementType::Angle);
-        projectile -> setProjectileSpeed(200.0f);
-
-        std::shared_ptr<TextureComponent> bossProjectileTexture = std::make_shared<TextureComponent>();
-        bossProjectileTexture -> CreateTextureComponent(mRenderer, "Assets/SoulReaper.bmp");
-        projectile -> AddComponent(bossProjectileTexture);
-        projectile -> GetTransform() -> setWidth(100.0f);
-        projectile -> GetTransform() -> setHeight(100.0f);
-
-        /// Launch projectile with calculated angle
-        projectile -> LaunchWithAngle(centerX, centerY, angle);
-        mProjectiles.push_back(projectile);
-     }
+    /// Fan of 13 projectiles from -90 to 90 degrees, every 15 degrees, with round hitboxes
+    VolleyDesc volley;
+    volley.count = 13;
+    volley.originX = centerX;
+    volley.originY = centerY;
+    volley.movement = ProjectileMovementType::Angle;
+    volley.angle = -90.0f - offset;
+    volley.angleStep = 15.0f;
+    volley.speed = 200.0f;
+    volley.sprite = "Assets/SoulReaper.bmp";
+    volley.width = 100.0f;
+    volley.height = 100.0f;
+    volley.hitboxShape = HitboxShape::Circle;  ///< A circle follows the round sprite at any angle
+    volley.hitboxScaleX = volley.hitboxScaleY = 0.8f;
+    Projectile::spawnVolley(volley, mRenderer, mProjectiles);
 }
 
 
@@ -475,44 +410,21 @@ void Boss::dragonBreath() {
     /// Calculate starting X position to center projectiles beneath the boss
     float startX = x + (width - totalProjectilesWidth) / 2.0f;
 
-    /**
-     * @brief Create all projectiles for this fire pattern
-     * @details Assign texture, movement type, start position and size for each projectile,
-     * and store them into the boss projectile vector
-     */
-    for (int i = 0; i < numProjectiles; i++) {
-        float projX = startX + mUltimateProjectileWidth * i;
-
-        std::shared_ptr<Projectile> projectile = std::make_shared<Projectile>(mRenderer);
-        projectile -> setIsPlayerProjectile(false);
-        projectile -> setIsBossProjectile(true);
-        projectile -> setIsUltimateProjectile(true);
-        projectile -> setUltimateProjectileSize(mUltimateProjectileWidth, mUltimateProjectileHeight);
-        projectile -> init();
-
-        projectile -> setProjectileSpeed(400.0f);  // 400 move speed(pixel in seconds) for this projectile
-        projectile -> setProjectileMovementType(ProjectileMovementType::UpDown);
-
-        /// Create texture
-        std::shared_ptr<TextureComponent> bossProjectileTexture = std::make_shared<TextureComponent>();
-        bossProjectileTexture -> CreateTextureComponent(mRenderer, "Assets/fireball.bmp");
-        projectile -> AddComponent(bossProjectileTexture);
-
-        /// Set size
-        projectile -> GetTransform() -> setWidth(mUltimateProjectileWidth);
-        projectile -> GetTransform() -> setHeight(mUltimateProjectileHeight);
-
-        /// Spawn projectile slightly below the boss
-        auto projTransform = projectile -> GetTransform();
-        if (projTransform) {
-            projTransform -> move(projX, y + 310); // y + boss size + 10 to spawn slightly below the boss
-        }
-
-        /// Activate projectile and launch downward
-        projectile -> Launch(projX, y, false);
-
-        mProjectiles.push_back(projectile);
-    }
+    /// Launch the whole row downward in one volley, spawned slightly below the boss (y + boss size + 10)
+    VolleyDesc volley;
+    volley.count = numProjectiles;
+    volley.originX = startX;
+    volley.originY = y + 310;
+    volley.spacingX = mUltimateProjectileWidth;
+    volley.movement = ProjectileMovementType::UpDown;
+    volley.upward = false;
+    volley.speed = 400.0f;  // 400 move speed(pixel in seconds) for this projectile
+    volley.sprite = "Assets/fireball.bmp";
+    volley.width = mUltimateProjectileWidth;
+    volley.height = mUltimateProjectileHeight;
+    volley.hitboxShape = HitboxShape::Circle;
+    volley.hitboxScaleX = volley.hitboxScaleY = 0.8f;
+    Projectile::spawnVolley(volley, mRenderer, mProjectiles);
 }
 
 /**
@@ -539,39 +451,21 @@ void Boss::fireLingeringGhostShot() {
     /// Base angle adjustment for inverted Y-axis (for boss projectiles, positive Y means downward)
     float offset = -90.0f;
 
-    /// Prepare list of firing angles (from -60 to 60 degrees, every 20 degrees)
-    std::vector<float> angles;
-    for (float angle = -60.0f; angle <= 60.0f; angle += 20.0f) {
-        angles.push_back(angle - offset);
-    }
-
-    /**
-     * @brief Create all projectiles for all given angles
-     * @details Assign texture, movement type, start position and size for each projectile,
-     * and store them into the boss projectile vector
-     */
-    for (float angle : angles) {
-        std::shared_ptr<Projectile> projectile = std::make_shared<Projectile>(mRenderer);
-        projectile -> setIsPlayerProjectile(false);
-        projectile -> setIsBossProjectile(true);
-        projectile -> init();
-
-        projectile -> setProjectileMovementType(ProjectileMovementType::Angle);
-
-        projectile -> setProjectileSpeed(100.0f); ///< Slow speed for lingering effect
-
-
-        std::shared_ptr<TextureComponent> bossProjectileTexture = std::make_shared<TextureComponent>();
-        bossProjectileTexture->CreateTextureComponent(mRenderer, "Assets/CursedFire.bmp");
-        projectile -> AddComponent(bossProjectileTexture);
-
-        projectile -> GetTransform() -> setWidth(80.0f);
-        projectile -> GetTransform() -> setHeight(80.0f);
-
-        /// Launch projectile with calculated angle
-        projectile -> LaunchWithAngle(centerX, centerY, angle);
-        mProjectiles.push_back(projectile);
-    }
+    /// Fan of 7 slow projectiles from -60 to 60 degrees, every 20 degrees, for a lingering effect
+    VolleyDesc volley;
+    volley.count = 7;
+    volley.originX = centerX;
+    volley.originY = centerY;
+    volley.movement = ProjectileMovementType::Angle;
+    volley.angle = -60.0f - offset;
+    volley.angleStep = 20.0f;
+    volley.speed = 100.0f;  ///< Slow speed for lingering effect
+    volley.sprite = "Assets/CursedFire.bmp";
+    volley.width = 80.0f;
+    volley.height = 80.0f;
+    volley.hitboxShape = HitboxShape::Circle;
+    volley.hitboxScaleX = volley.hitboxScaleY = 0.8f;
+    Projectile::spawnVolley(volley, mRenderer, mProjectiles);
 }
 
 /**
@@ -601,30 +495,26 @@ void Boss::slash() {
     /// Calculate angle (in radians) towards the player
     float angleRadians = atan2(directionY, directionX);
 
-    /// Convert radians to degrees for Launch function
+    /// Convert radians to degrees for the volley description
     float angleDegrees = angleRadians * (180.0f / 3.14159265f);
 
-   /// Create a single tracking projectile
-    std::shared_ptr<Projectile> projectile = std::make_shared<Projectile>(mRenderer);
-    projectile -> setIsPlayerProjectile(false);
-    projectile -> setIsBossProjectile(true);
-    projectile -> init();
-
-    projectile -> setProjectileMovementType(ProjectileMovementType::Tracking);
-
-    projectile -> setProjectileSpeed(450.0f); ///< Fast speed for tracking slash
-
-    std::shared_ptr<TextureComponent> bossProjectileTexture = std::make_shared<TextureComponent>();
-    bossProjectileTexture -> CreateTextureComponent(mRenderer, "Assets/Slash.bmp");
-    projectile -> AddComponent(bossProjectileTexture);
-
-    projectile -> GetTransform() -> setWidth(160.0f);
-    projectile -> GetTransform() -> setHeight(120.0f);
-
-    /// Launch projectile towards player (degrees input for consistency)
-    projectile -> LaunchWithTracking(bossX, bossY, angleDegrees);
-    mProjectiles.push_back(projectile);
-
+    /**
+     * @brief Launch a single tracking projectile towards the player (degrees input for consistency)
+     * @details The slash spins, so its hitbox is a box that rotates with the sprite
+     */
+    VolleyDesc volley;
+    volley.originX = bossX;
+    volley.originY = bossY;
+    volley.movement = ProjectileMovementType::Tracking;
+    volley.angle = angleDegrees;
+    volley.speed = 450.0f;  ///< Fast speed for tracking slash
+    volley.sprite = "Assets/Slash.bmp";
+    volley.width = 160.0f;
+    volley.height = 120.0f;
+    volley.hitboxShape = HitboxShape::OrientedBox;
+    volley.hitboxScaleX = 0.85f;
+    volley.hitboxScaleY = 0.6f;
+    Projectile::spawnVolley(volley, mRenderer, mProjectiles);
 }
 
 /**
@@ -645,9 +535,10 @@ void Boss::onHit() {
  */
 void Boss::init() {
     /// Create a TextureComponent for this boss
-    std::shared_ptr<TextureComponent> texture = std::make_shared<TextureComponent>();
+    std::shared_ptr<TextureComponent> texture = SceneArena::makeShared<TextureComponent>();
     /// Create a Collision2DComponent for this boss
-    std::shared_ptr<Collision2DComponent> hitbox = std::make_shared<Collision2DComponent>();
+    std::shared_ptr<Collision2DComponent> hitbox = SceneArena::makeShared<Collision2DComponent>();
+    hitbox -> setLayer(CollisionLayer::Boss, CollisionLayer::PlayerProjectile);
     texture -> CreateTextureComponent(mRenderer, mTexturePath);  // Load texture for this boss
     AddDefaultTransform();                                      // Add a TransformComponent to this boss
     auto transform = GetTransform();
@@ -7,6 +7,8 @@
 
 #include "Collision2DComponent.hpp"
 #include "GameEntity.hpp"
+#include <algorithm>
+#include <cmath>
 
 
 /**
@@ -30,8 +32,20 @@ void Collision2DComponent::update(float deltaTime) {
         return;    ///< Exit early if no transform component is found
     }
 
-    float fullWidth = transform -> getWidth();
-    float fullHeight = transform -> getHeight();
+    sync(*transform);
+}
+
+/**
+ * @brief Move the collision bounds to the given transform
+ * @details Calculates the adjusted hitbox size and position according to width/height modifiers.
+ * @param transform Transform of the owning entity
+ */
+void Collision2DComponent::sync(const TransformComponent& transform) {
+    /// Remember where the hitbox was for continuous collision
+    mPreviousRectangle = mRectangle;
+
+    float fullWidth = transform.getWidth();
+    float fullHeight = transform.getHeight();
 
     /// Apply width and height modifiers to adjust hitbox size
     float reducedWidth = fullWidth * mWidthModifier;
@@ -41,10 +55,53 @@ void Collision2DComponent::update(float deltaTime) {
      * @brief Center the reduced hitbox inside the full transform rectangle
      * Design choice: keep hitbox centered even when reduced, for fair collision detection.
      */
-    mRectangle.x = transform -> getX() + (fullWidth - reducedWidth) / 2.0f;
-    mRectangle.y = transform -> getY() + (fullHeight - reducedHeight) / 2.0f;
-    mRectangle.w = reducedWidth;
-    mRectangle.h = reducedHeight;
+    HitboxGeometry& geometry = mGeometry;
+    geometry.centerX = transform.getX() + fullWidth / 2.0f;
+    geometry.centerY = transform.getY() + fullHeight / 2.0f;
+    geometry.halfWidth = reducedWidth / 2.0f;
+    geometry.halfHeight = reducedHeight / 2.0f;
+    geometry.axisX = 1.0f;
+    geometry.axisY = 0.0f;
+
+    /// Half extents of the axis-aligned bounds
+    float extentX = geometry.halfWidth;
+    float extentY = geometry.halfHeight;
+
+    switch (geometry.shape) {
+        case HitboxShape::Box:
+            geometry.boundingRadius = std::sqrt(extentX * extentX + extentY * extentY);
+            break;
+
+        case HitboxShape::Circle:
+            geometry.halfWidth = geometry.halfHeight = std::min(geometry.halfWidth, geometry.halfHeight);
+            extentX = extentY = geometry.halfWidth;
+            geometry.boundingRadius = geometry.halfWidth;
+            break;
+
+        case HitboxShape::OrientedBox: {
+            /// SDL rotates clockwise on screen, which is a standard rotation with Y pointing down
+            float radians = transform.getRotation() * (3.14159265f / 180.0f);
+            geometry.axisX = std::cos(radians);
+            geometry.axisY = std::sin(radians);
+            float absCos = std::fabs(geometry.axisX);
+            float absSin = std::fabs(geometry.axisY);
+            extentX = geometry.halfWidth * absCos + geometry.halfHeight * absSin;
+            extentY = geometry.halfWidth * absSin + geometry.halfHeight * absCos;
+            geometry.boundingRadius = std::sqrt(geometry.halfWidth * geometry.halfWidth +
+                                                geometry.halfHeight * geometry.halfHeight);
+            break;
+        }
+    }
+
+    mRectangle.x = geometry.centerX - extentX;
+    mRectangle.y = geometry.centerY - extentY;
+    mRectangle.w = extentX * 2.0f;
+    mRectangle.h = extentY * 2.0f;
+
+    if (!mHasPrevious) {
+        mPreviousRectangle = mRectangle;
+        mHasPrevious = true;
+    }
 }
 
 /**
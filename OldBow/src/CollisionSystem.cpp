@@ -0,0 +1,247 @@
+/**
+ * @file CollisionSystem.cpp
+ * @brief CollisionSystem class implementation
+ * Uniform grid broadphase and AABB / SAT narrowphase producing a per-frame contact list
+ */
+
+#include "CollisionSystem.hpp"
+#include "GameEntity.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Constructor, sizes the grid to the window
+ */
+CollisionSystem::CollisionSystem() {
+    mColumns = static_cast<int>(std::ceil(WINDOW_WIDTH / CellSize));
+    mRows = static_cast<int>(std::ceil(WINDOW_HEIGHT / CellSize));
+    mCells.resize(mColumns * mRows);
+}
+
+/**
+ * @brief Remove all colliders and contacts of the previous frame
+ */
+void CollisionSystem::clear() {
+    mColliders.clear();
+    mContacts.clear();
+}
+
+/**
+ * @brief Register an entity's hitbox for this frame
+ * @param entity Entity to register
+ * @param tag Caller defined value copied into the collider
+ */
+void CollisionSystem::add(GameEntity& entity, int tag) {
+    const Collision2DComponent* hitbox = entity.GetCollision();
+    if (!hitbox || hitbox -> getLayer() == CollisionLayer::None) {
+        return;
+    }
+    SDL_FRect rect = hitbox -> getRectangle();
+    SDL_FRect previous = hitbox -> getPreviousRectangle();
+
+    /// Sweep only when one step moved the hitbox further than its own size
+    bool swept = std::fabs(rect.x - previous.x) > rect.w || std::fabs(rect.y - previous.y) > rect.h;
+    SDL_FRect bounds = rect;
+    if (swept) {
+        float left = std::min(rect.x, previous.x);
+        float top = std::min(rect.y, previous.y);
+        bounds = { left, top,
+                   std::max(rect.x + rect.w, previous.x + previous.w) - left,
+                   std::max(rect.y + rect.h, previous.y + previous.h) - top };
+    }
+
+    mColliders.push_back({ &entity, rect, previous, bounds, swept, hitbox -> getGeometry(),
+                           hitbox -> getLayer(), hitbox -> getMask(), tag });
+}
+
+/**
+ * @brief Get the grid column of an x coordinate, clamped to the grid
+ */
+int CollisionSystem::cellColumn(float x) const {
+    return std::max(0, std::min(static_cast<int>(x / CellSize), mColumns - 1));
+}
+
+/**
+ * @brief Get the grid row of a y coordinate, clamped to the grid
+ */
+int CollisionSystem::cellRow(float y) const {
+    return std::max(0, std::min(static_cast<int>(y / CellSize), mRows - 1));
+}
+
+/**
+ * @brief Find every overlapping pair allowed by the layer masks
+ */
+void CollisionSystem::detect() {
+    mContacts.clear();
+    for (auto& cell : mCells) {
+        cell.clear();
+    }
+
+    /// Broadphase: drop every collider into each cell it overlaps
+    for (int i = 0; i < static_cast<int>(mColliders.size()); i++) {
+        const SDL_FRect& rect = mColliders[i].bounds;
+        int left = cellColumn(rect.x);
+        int right = cellColumn(rect.x + rect.w);
+        int top = cellRow(rect.y);
+        int bottom = cellRow(rect.y + rect.h);
+        for (int row = top; row <= bottom; row++) {
+            for (int column = left; column <= right; column++) {
+                mCells[row * mColumns + column].push_back(i);
+            }
+        }
+    }
+
+    /// Narrowphase: test the pairs sharing a cell
+    for (int cellIndex = 0; cellIndex < static_cast<int>(mCells.size()); cellIndex++) {
+        const std::vector<int>& cell = mCells[cellIndex];
+        for (size_t i = 0; i < cell.size(); i++) {
+            const Collider& a = mColliders[cell[i]];
+            for (size_t j = i + 1; j < cell.size(); j++) {
+                const Collider& b = mColliders[cell[j]];
+                if (!(a.mask & b.layer) && !(b.mask & a.layer)) {
+                    continue;  ///< Layers do not interact
+                }
+                if (a.swept || b.swept) {
+                    /// Fast mover: test the whole step instead of the end position
+                    if (!sweptOverlap(a, b)) {
+                        continue;
+                    }
+                } else {
+                    /// Axis-aligned box overlap, exact for two boxes
+                    if (b.rect.x + b.rect.w <= a.rect.x || a.rect.x + a.rect.w <= b.rect.x ||
+                        b.rect.y + b.rect.h <= a.rect.y || a.rect.y + a.rect.h <= b.rect.y) {
+                        continue;
+                    }
+                    if ((a.geometry.shape != HitboxShape::Box || b.geometry.shape != HitboxShape::Box) &&
+                        !shapesOverlap(a, b)) {
+                        continue;
+                    }
+                }
+                /// Report the pair only from the cell holding the top left corner of the overlap
+                int ownerCell = cellRow(std::max(a.bounds.y, b.bounds.y)) * mColumns +
+                                cellColumn(std::max(a.bounds.x, b.bounds.x));
+                if (ownerCell == cellIndex) {
+                    mContacts.push_back({ cell[i], cell[j] });
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Exact overlap test of two hitboxes whose bounds already overlap
+ * @details Circles and boxes are both described by a center, two unit axes and half extents
+ * (a box's axes are the world axes). Every test is written over small fixed arrays so the
+ * compiler can keep it in SIMD registers.
+ */
+bool CollisionSystem::shapesOverlap(const Collider& a, const Collider& b) {
+    const HitboxGeometry& first = a.geometry;
+    const HitboxGeometry& second = b.geometry;
+    float dx = second.centerX - first.centerX;
+    float dy = second.centerY - first.centerY;
+    float distanceSquared = dx * dx + dy * dy;
+
+    /// Early out: bounding circles apart means the shapes are apart
+    float reach = first.boundingRadius + second.boundingRadius;
+    if (distanceSquared >= reach * reach) {
+        return false;
+    }
+
+    bool firstIsCircle = first.shape == HitboxShape::Circle;
+    bool secondIsCircle = second.shape == HitboxShape::Circle;
+
+    /// Circle vs circle: the bounding circles are the shapes
+    if (firstIsCircle && secondIsCircle) {
+        return true;
+    }
+
+    /// Circle vs box: closest point of the box to the circle's center, in the box's frame
+    if (firstIsCircle || secondIsCircle) {
+        const HitboxGeometry& circle = firstIsCircle ? first : second;
+        const HitboxGeometry& box = firstIsCircle ? second : first;
+        float offsetX = circle.centerX - box.centerX;
+        float offsetY = circle.centerY - box.centerY;
+        float local[2] = { offsetX * box.axisX + offsetY * box.axisY,
+                           -offsetX * box.axisY + offsetY * box.axisX };
+        float extent[2] = { box.halfWidth, box.halfHeight };
+        float distance = 0.0f;
+        for (int i = 0; i < 2; i++) {
+            float outside = std::max(std::fabs(local[i]) - extent[i], 0.0f);
+            distance += outside * outside;
+        }
+        return distance < circle.halfWidth * circle.halfWidth;
+    }
+
+    /// Box vs box (at least one oriented): separating axis test on both boxes' axes
+    float axesX[4] = { first.axisX, -first.axisY, second.axisX, -second.axisY };
+    float axesY[4] = { first.axisY, first.axisX, second.axisY, second.axisX };
+    for (int i = 0; i < 4; i++) {
+        float firstRadius = first.halfWidth * std::fabs(first.axisX * axesX[i] + first.axisY * axesY[i]) +
+                            first.halfHeight * std::fabs(-first.axisY * axesX[i] + first.axisX * axesY[i]);
+        float secondRadius = second.halfWidth * std::fabs(second.axisX * axesX[i] + second.axisY * axesY[i]) +
+                             second.halfHeight * std::fabs(-second.axisY * axesX[i] + second.axisX * axesY[i]);
+        if (std::fabs(dx * axesX[i] + dy * axesY[i]) >= firstRadius + secondRadius) {
+            return false;  ///< Found a separating axis
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Swept AABB test of two boxes moving linearly over the last step
+ * @details Works in a's frame of reference: a moves by the difference of both displacements
+ * while b stays at its previous position. The slab method gives, per axis, the part of the step
+ * during which the boxes overlap; they hit if those intervals intersect inside the step.
+ * @return True if they touched at any time during the step
+ */
+bool CollisionSystem::sweptOverlap(const Collider& a, const Collider& b) {
+    const SDL_FRect& startA = a.previous;
+    const SDL_FRect& startB = b.previous;
+    float motion[2] = { (a.rect.x - a.previous.x) - (b.rect.x - b.previous.x),
+                        (a.rect.y - a.previous.y) - (b.rect.y - b.previous.y) };
+    float minA[2] = { startA.x, startA.y };
+    float maxA[2] = { startA.x + startA.w, startA.y + startA.h };
+    float minB[2] = { startB.x, startB.y };
+    float maxB[2] = { startB.x + startB.w, startB.y + startB.h };
+
+    float entry = 0.0f;  ///< Latest time at which the boxes start overlapping on an axis
+    float exit = 1.0f;   ///< Earliest time at which they stop overlapping on an axis
+    for (int axis = 0; axis < 2; axis++) {
+        if (motion[axis] == 0.0f) {
+            /// No relative motion on this axis, they must already overlap on it
+            if (maxA[axis] <= minB[axis] || maxB[axis] <= minA[axis]) {
+                return false;
+            }
+            continue;
+        }
+        float first = (minB[axis] - maxA[axis]) / motion[axis];
+        float second = (maxB[axis] - minA[axis]) / motion[axis];
+        entry = std::max(entry, std::min(first, second));
+        exit = std::min(exit, std::max(first, second));
+        if (entry >= exit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Match a contact against two layers
+ * @return True if the contact is between layerA and layerB
+ */
+bool CollisionSystem::match(const Contact& contact, Uint32 layerA, Uint32 layerB,
+                            const Collider*& a, const Collider*& b) const {
+    const Collider& first = mColliders[contact.first];
+    const Collider& second = mColliders[contact.second];
+    if ((first.layer & layerA) && (second.layer & layerB)) {
+        a = &first;
+        b = &second;
+        return true;
+    }
+    if ((second.layer & layerA) && (first.layer & layerB)) {
+        a = &second;
+        b = &first;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,468 @@
+/**
+ * @file CompiledAssets.cpp
+ * @brief Boss and dialogue asset loading implementation
+ * @details Implements the validating "Key: Value" text parsers, the binary blob writers used by
+ * the offline asset compiler, and the single-read blob loaders used by the runtime.
+ */
+
+#include "CompiledAssets.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <sys/stat.h>
+
+namespace {
+
+    /// Magic numbers identifying each blob type
+    const char BossMagic[4] = {'O', 'B', 'B', 'S'};
+    const char DialogueMagic[4] = {'O', 'B', 'D', 'L'};
+
+    /// Highest HP a boss file may set
+    const long MaxBossHP = 1000000;
+
+    /**
+     * @brief Trim leading and trailing spaces, tabs and carriage returns
+     * @param str Input string to be trimmed
+     * @return Trimmed copy of the string
+     */
+    std::string trim(const std::string& str) {
+        size_t first = str.find_first_not_of(" \t\r");
+        if (first == std::string::npos) {
+            return "";
+        }
+        size_t last = str.find_last_not_of(" \t\r");
+        return str.substr(first, last - first + 1);
+    }
+
+    /**
+     * @brief Format an error entry as "file:line: message"
+     */
+    std::string makeError(const std::string& filePath, int lineNumber, const std::string& message) {
+        return filePath + ":" + std::to_string(lineNumber) + ": " + message;
+    }
+
+    /**
+     * @brief Read a whole file into memory with a single read
+     * @param filePath Path to the file
+     * @param buffer Receives the file contents
+     * @return True if the file was read completely
+     */
+    bool readWholeFile(const std::string& filePath, std::vector<char>& buffer) {
+        std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return false;
+        }
+        std::streamsize size = file.tellg();
+        if (size <= 0) {
+            return false;
+        }
+        buffer.resize(static_cast<size_t>(size));
+        file.seekg(0);
+        return static_cast<bool>(file.read(buffer.data(), size));
+    }
+
+#ifndef NDEBUG
+    /**
+     * @brief Check if a text asset was edited after its blob was compiled
+     * @param textPath Path to the text file
+     * @param binaryPath Path to the compiled blob
+     * @return True if the text file is newer than the blob or the blob is missing
+     */
+    bool isTextNewer(const std::string& textPath, const std::string& binaryPath) {
+        struct stat textInfo;
+        struct stat binaryInfo;
+        if (stat(textPath.c_str(), &textInfo) != 0) {
+            return false;
+        }
+        return stat(binaryPath.c_str(), &binaryInfo) != 0 || textInfo.st_mtime > binaryInfo.st_mtime;
+    }
+#endif
+
+    /**
+     * @brief Map a pattern name from a boss file to its enum value
+     * @return True if the name is a known pattern
+     */
+    bool patternFromName(const std::string& name, PatternType& out) {
+        if (name == "Rain")     { out = PatternType::Rain;      return true; }
+        if (name == "Spread")   { out = PatternType::Spread;    return true; }
+        if (name == "Ultimate") { out = PatternType::Ultimate;  return true; }
+        if (name == "Ghost")    { out = PatternType::GhostFire; return true; }
+        if (name == "Slash")    { out = PatternType::Slash;     return true; }
+        return false;
+    }
+}
+
+/**
+ * @brief Get the compiled blob path for a text asset
+ * @param textPath Path to the text file
+ * @return Same path with the ".txt" extension replaced by ".bin"
+ */
+std::string CompiledAssets::compiledPath(const std::string& textPath) {
+    size_t dot = textPath.find_last_of('.');
+    size_t slash = textPath.find_last_of("/\\");
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return textPath + ".bin";
+    }
+    return textPath.substr(0, dot) + ".bin";
+}
+
+/**
+ * @brief Parse and validate a boss text file
+ * @details Each line follows the format "Key: Value". Supported keys:
+ * - ID: Identifier of the boss (Boss1, Boss2, Boss3)
+ * - Name: Name of the boss
+ * - HP: Hit points of the boss (positive integer)
+ * - PatternList: List of attack patterns, separated by commas
+ * - Texture: Path to the texture file
+ *
+ * Every key is required exactly once. Problems are collected instead of stopping at the first one,
+ * so a single compiler run reports everything wrong with a file.
+ */
+bool CompiledAssets::parseBossText(const std::string& filePath, BossDefinition& out, std::vector<std::string>& errors) {
+    size_t errorsBefore = errors.size();
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        errors.push_back(filePath + ": could not open boss file");
+        return false;
+    }
+
+    bool seenID = false, seenName = false, seenHP = false, seenPatterns = false, seenTexture = false;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (trim(line).empty()) {
+            continue;
+        }
+        size_t separatorPos = line.find(':');
+        if (separatorPos == std::string::npos) {
+            errors.push_back(makeError(filePath, lineNumber, "expected 'Key: Value'"));
+            continue;
+        }
+        std::string key = trim(line.substr(0, separatorPos));
+        std::string value = trim(line.substr(separatorPos + 1));
+
+        if (key == "ID") {
+            if (seenID) errors.push_back(makeError(filePath, lineNumber, "duplicate ID"));
+            seenID = true;
+            if (value == "Boss1") {
+                out.id = BossID::Boss1;
+            } else if (value == "Boss2") {
+                out.id = BossID::Boss2;
+            } else if (value == "Boss3") {
+                out.id = BossID::Boss3;
+            } else {
+                errors.push_back(makeError(filePath, lineNumber,
+                                           "unknown ID '" + value + "' (expected Boss1, Boss2 or Boss3)"));
+            }
+        } else if (key == "Name") {
+            if (seenName) errors.push_back(makeError(filePath, lineNumber, "duplicate Name"));
+            seenName = true;
+            if (value.empty() || value.size() >= MaxBossNameLength) {
+                errors.push_back(makeError(filePath, lineNumber, "Name must be 1 to 63 characters"));
+            }
+            out.name = value;
+        } else if (key == "HP") {
+            if (seenHP) errors.push_back(makeError(filePath, lineNumber, "duplicate HP"));
+            seenHP = true;
+            char* end = nullptr;
+            long hp = std::strtol(value.c_str(), &end, 10);
+            if (value.empty() || *end != '\0' || hp <= 0 || hp > MaxBossHP) {
+                errors.push_back(makeError(filePath, lineNumber, "HP must be a positive integer, got '" + value + "'"));
+            } else {
+                out.hp = static_cast<int>(hp);
+            }
+        } else if (key == "PatternList") {
+            if (seenPatterns) errors.push_back(makeError(filePath, lineNumber, "duplicate PatternList"));
+            seenPatterns = true;
+            out.patterns.clear();
+            std::stringstream container(value);
+            std::string pattern;
+            while (std::getline(container, pattern, ',')) {
+                pattern = trim(pattern);
+                PatternType type;
+                if (patternFromName(pattern, type)) {
+                    out.patterns.push_back(type);
+                } else {
+                    errors.push_back(makeError(filePath, lineNumber, "unknown pattern type '" + pattern + "'"));
+                }
+            }
+            if (out.patterns.empty()) {
+                errors.push_back(makeError(filePath, lineNumber, "PatternList is empty"));
+            } else if (out.patterns.size() > MaxBossPatterns) {
+                errors.push_back(makeError(filePath, lineNumber, "too many patterns (max 12)"));
+                out.patterns.resize(MaxBossPatterns);
+            }
+        } else if (key == "Texture") {
+            if (seenTexture) errors.push_back(makeError(filePath, lineNumber, "duplicate Texture"));
+            seenTexture = true;
+            if (value.empty() || value.size() >= MaxTexturePathLength) {
+                errors.push_back(makeError(filePath, lineNumber, "Texture must be 1 to 127 characters"));
+            }
+            out.texturePath = value;
+        } else {
+            errors.push_back(makeError(filePath, lineNumber, "unknown key '" + key + "'"));
+        }
+    }
+
+    /// Report every required key that never appeared
+    if (!seenID)       errors.push_back(filePath + ": missing ID");
+    if (!seenName)     errors.push_back(filePath + ": missing Name");
+    if (!seenHP)       errors.push_back(filePath + ": missing HP");
+    if (!seenPatterns) errors.push_back(filePath + ": missing PatternList");
+    if (!seenTexture)  errors.push_back(filePath + ": missing Texture");
+
+    return errors.size() == errorsBefore;
+}
+
+/**
+ * @brief Parse and validate a dialogue text file
+ * @details Supported keys are "background" (at most once) and "line". Keys are case sensitive,
+ * so a stray "Line:" is reported instead of being silently dropped.
+ */
+bool CompiledAssets::parseDialogueText(const std::string& filePath, DialogueScript& out, std::vector<std::string>& errors,
+                                       const LineCallback& onLine) {
+    size_t errorsBefore = errors.size();
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        errors.push_back(filePath + ": could not open dialogue file");
+        return false;
+    }
+
+    bool seenBackground = false;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (trim(line).empty()) {
+            continue;
+        }
+        size_t separatorPos = line.find(':');
+        if (separatorPos == std::string::npos) {
+            errors.push_back(makeError(filePath, lineNumber, "expected 'key: value'"));
+            continue;
+        }
+        std::string key = line.substr(0, separatorPos);
+        std::string value = trim(line.substr(separatorPos + 1));
+
+        if (key == "background") {
+            if (seenBackground) errors.push_back(makeError(filePath, lineNumber, "duplicate background"));
+            seenBackground = true;
+            out.backgroundPath = value;
+        } else if (key == "line") {
+            out.lines.push_back(value);
+            if (onLine) {
+                onLine(out.lines.back());
+            }
+        } else {
+            errors.push_back(makeError(filePath, lineNumber, "unknown key '" + key + "'"));
+        }
+    }
+
+    if (out.lines.empty()) {
+        errors.push_back(filePath + ": dialogue has no lines");
+    } else if (out.lines.size() > 0xFFFF) {
+        errors.push_back(filePath + ": too many dialogue lines");
+    }
+    return errors.size() == errorsBefore;
+}
+
+/**
+ * @brief Write a compiled boss blob
+ */
+bool CompiledAssets::writeBossBinary(const std::string& filePath, const BossDefinition& def) {
+    BossRecord record{};
+    std::memcpy(record.magic, BossMagic, sizeof(record.magic));
+    record.version = FormatVersion;
+    record.id = static_cast<std::uint8_t>(def.id);
+    record.hp = def.hp;
+    record.patternCount = static_cast<std::uint8_t>(std::min(def.patterns.size(), MaxBossPatterns));
+    for (size_t i = 0; i < record.patternCount; i++) {
+        record.patterns[i] = static_cast<std::uint8_t>(def.patterns[i]);
+    }
+    std::strncpy(record.name, def.name.c_str(), MaxBossNameLength - 1);
+    std::strncpy(record.texture, def.texturePath.c_str(), MaxTexturePathLength - 1);
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Write a compiled dialogue blob
+ */
+bool CompiledAssets::writeDialogueBinary(const std::string& filePath, const DialogueScript& script) {
+    /// Build the string pool: background first, then every line, all NUL-terminated
+    std::vector<std::uint32_t> offsets;
+    std::string pool;
+    offsets.push_back(0);
+    pool.append(script.backgroundPath).push_back('\0');
+    for (const std::string& line : script.lines) {
+        offsets.push_back(static_cast<std::uint32_t>(pool.size()));
+        pool.append(line).push_back('\0');
+    }
+
+    DialogueHeader header{};
+    std::memcpy(header.magic, DialogueMagic, sizeof(header.magic));
+    header.version = FormatVersion;
+    header.lineCount = static_cast<std::uint16_t>(script.lines.size());
+    header.poolSize = static_cast<std::uint32_t>(pool.size());
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(std::uint32_t));
+    file.write(pool.data(), pool.size());
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Read a compiled boss blob with a single read
+ */
+bool CompiledAssets::readBossBinary(const std::string& filePath, BossDefinition& out) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    BossRecord record;
+    if (!file.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        return false;
+    }
+    if (std::memcmp(record.magic, BossMagic, sizeof(record.magic)) != 0 ||
+        record.version != FormatVersion ||
+        record.id > static_cast<std::uint8_t>(BossID::Boss3) ||
+        record.patternCount > MaxBossPatterns ||
+        record.hp <= 0 || record.hp > MaxBossHP) {
+        return false;
+    }
+
+    /// Force termination in case the blob was hand-edited
+    record.name[MaxBossNameLength - 1] = '\0';
+    record.texture[MaxTexturePathLength - 1] = '\0';
+
+    out.id = static_cast<BossID>(record.id);
+    out.hp = record.hp;
+    out.name = record.name;
+    out.texturePath = record.texture;
+    out.patterns.clear();
+    for (size_t i = 0; i < record.patternCount; i++) {
+        if (record.patterns[i] > static_cast<std::uint8_t>(PatternType::Slash)) {
+            return false;
+        }
+        out.patterns.push_back(static_cast<PatternType>(record.patterns[i]));
+    }
+    return true;
+}
+
+/**
+ * @brief Read a compiled dialogue blob with a single read
+ */
+bool CompiledAssets::readDialogueBinary(const std::string& filePath, DialogueScript& out) {
+    std::vector<char> buffer;
+    if (!readWholeFile(filePath, buffer) || buffer.size() < sizeof(DialogueHeader)) {
+        return false;
+    }
+
+    DialogueHeader header;
+    std::memcpy(&header, buffer.data(), sizeof(header));
+    size_t offsetsSize = (static_cast<size_t>(header.lineCount) + 1) * sizeof(std::uint32_t);
+    if (std::memcmp(header.magic, DialogueMagic, sizeof(header.magic)) != 0 ||
+        header.version != FormatVersion ||
+        buffer.size() != sizeof(header) + offsetsSize + header.poolSize ||
+        header.poolSize == 0 || buffer.back() != '\0') {
+        return false;
+    }
+
+    const char* offsetTable = buffer.data() + sizeof(header);
+    const char* pool = offsetTable + offsetsSize;
+    auto stringAt = [&](size_t index, std::string& value) {
+        std::uint32_t offset;
+        std::memcpy(&offset, offsetTable + index * sizeof(offset), sizeof(offset));
+        if (offset >= header.poolSize) {
+            return false;
+        }
+        value.assign(pool + offset);
+        return true;
+    };
+
+    if (!stringAt(0, out.backgroundPath)) {
+        return false;
+    }
+    out.lines.resize(header.lineCount);
+    for (size_t i = 0; i < header.lineCount; i++) {
+        if (!stringAt(i + 1, out.lines[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Load a boss definition, preferring the compiled blob
+ */
+bool CompiledAssets::loadBoss(const std::string& textPath, BossDefinition& out) {
+    std::string binaryPath = compiledPath(textPath);
+#ifdef NDEBUG
+    if (readBossBinary(binaryPath, out)) {
+        return true;
+    }
+    std::cerr << "ERROR: Missing or invalid compiled boss file for: " << textPath << std::endl;
+    return false;
+#else
+    /// Dev build: a blob older than its text file is stale, so edits show up without recompiling
+    if (!isTextNewer(textPath, binaryPath) && readBossBinary(binaryPath, out)) {
+        return true;
+    }
+
+    /// Parse the text file directly, loading whatever is valid
+    out = BossDefinition{};
+    std::vector<std::string> errors;
+    parseBossText(textPath, out, errors);
+    for (const std::string& error : errors) {
+        std::cerr << "WARNING! " << error << std::endl;
+    }
+    return !out.patterns.empty() || !out.texturePath.empty();
+#endif
+}
+
+/**
+ * @brief Load a dialogue script, preferring the compiled blob
+ */
+bool CompiledAssets::loadDialogue(const std::string& textPath, DialogueScript& out, const LineCallback& onLine) {
+    /// A blob arrives in one read, its lines are handed over together
+    auto publishAll = [&]() {
+        if (onLine) {
+            for (const std::string& line : out.lines) {
+                onLine(line);
+            }
+        }
+        return true;
+    };
+    std::string binaryPath = compiledPath(textPath);
+#ifdef NDEBUG
+    if (readDialogueBinary(binaryPath, out)) {
+        return publishAll();
+    }
+    std::cerr << "ERROR: Missing or invalid compiled dialogue file for: " << textPath << std::endl;
+    return false;
+#else
+    if (!isTextNewer(textPath, binaryPath) && readDialogueBinary(binaryPath, out)) {
+        return publishAll();
+    }
+    out = DialogueScript{};
+    std::vector<std::string> errors;
+    parseDialogueText(textPath, out, errors, onLine);
+    for (const std::string& error : errors) {
+        std::cerr << "WARNING! " << error << std::endl;
+    }
+    return !out.lines.empty();
+#endif
+}
@@ -0,0 +1,134 @@
+/**
+ * @file DebugOverlay.cpp
+ * @brief DebugOverlay class implementation
+ * Summarize frame statistics and draw them with the glyph atlas
+ */
+
+#include "DebugOverlay.hpp"
+#include "RenderStats.hpp"
+#include "AllocationTracker.hpp"
+#include <algorithm>
+#include <cstdio>
+
+/// Draw call counter, reset by the application at the start of every frame
+unsigned int RenderStats::drawCalls = 0;
+
+/// Font and size of the overlay text
+static const char* OverlayFont = "Assets/Merriweather.ttf";
+static const int OverlayFontSize = 16;
+
+/// Length of the percentile window and text refresh interval in milliseconds
+static const Uint32 WindowLength = 1000;
+static const Uint32 RebuildInterval = 250;
+
+/**
+ * @brief Record the timing of a finished frame
+ * @details When the one second window is complete, its percentiles and averages
+ * replace the displayed values and a new window starts.
+ * @param timing Stage timings and draw calls of the frame
+ */
+void DebugOverlay::recordFrame(const FrameTiming& timing) {
+    mWindow.add(timing.frameMs);
+    mUpdateSum += timing.updateMs;
+    mRenderSum += timing.renderMs;
+    mPresentSum += timing.presentMs;
+    mDrawCalls = timing.drawCalls;
+    mRenderScale = timing.renderScale;
+
+    Uint32 now = SDL_GetTicks();
+    if (now - mWindowStart < WindowLength) {
+        return;
+    }
+    unsigned int frames = mWindow.getCount();
+    mP50 = mWindow.getPercentile(50);
+    mP95 = mWindow.getPercentile(95);
+    mP99 = mWindow.getPercentile(99);
+    mUpdateMs = mUpdateSum / frames;
+    mRenderMs = mRenderSum / frames;
+    mPresentMs = mPresentSum / frames;
+
+    mWindow.reset();
+    mUpdateSum = mRenderSum = mPresentSum = 0.0;
+    mWindowStart = now;
+    mDirty = true;
+}
+
+/**
+ * @brief Draw the overlay in the top left corner
+ * @param renderer SDL renderer
+ * @param counts Live entity counts of the current scene
+ * @param fireLatency Average input-to-fire latency in milliseconds, negative if unknown
+ */
+void DebugOverlay::render(SDL_Renderer* renderer, const SceneEntityCounts& counts, float fireLatency) {
+    if (!mVisible) {
+        return;
+    }
+    /// Rasterize the glyphs once, the first time the overlay is shown
+    if (!mAtlasBuilt) {
+        mAtlasBuilt = true;
+        mAtlas.build(renderer, OverlayFont, OverlayFontSize);
+    }
+    if (!mAtlas.isReady()) {
+        return;
+    }
+
+    Uint32 now = SDL_GetTicks();
+    if (mDirty || now - mLastRebuild >= RebuildInterval) {
+        rebuild(counts, fireLatency);
+        mLastRebuild = now;
+        mDirty = false;
+    }
+
+    /// Dark box behind the text so it stays readable over any background
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(renderer, &mPanel);
+    RenderStats::drawCalls++;
+
+    mAtlas.draw(renderer, mVertices, mIndices);
+}
+
+/**
+ * @brief Lay the overlay text out into the cached vertex list
+ */
+void DebugOverlay::rebuild(const SceneEntityCounts& counts, float fireLatency) {
+    char lines[8][112];
+    std::snprintf(lines[0], sizeof(lines[0]), "Frame  p50 %.1f  p95 %.1f  p99 %.1f ms", mP50, mP95, mP99);
+    std::snprintf(lines[1], sizeof(lines[1]), "Update %.2f  Render %.2f  Present %.2f ms", mUpdateMs, mRenderMs, mPresentMs);
+    std::snprintf(lines[2], sizeof(lines[2]), "Draw calls %u  Resolution %d%%", mDrawCalls,
+                  static_cast<int>(mRenderScale * 100.0f + 0.5f));
+    std::snprintf(lines[3], sizeof(lines[3]), "Enemies %d  Bosses %d", counts.enemies, counts.bosses);
+    std::snprintf(lines[4], sizeof(lines[4]), "Projectiles  player %d  enemy %d  boss %d  global %d",
+                  counts.playerProjectiles, counts.enemyProjectiles, counts.bossProjectiles, counts.globalProjectiles);
+    std::snprintf(lines[5], sizeof(lines[5]), "Culled %d  Retired %u  Particles %d", counts.culled, counts.retired, counts.particles);
+    if (fireLatency >= 0.0f) {
+        std::snprintf(lines[6], sizeof(lines[6]), "Input-to-fire %.1f ms", fireLatency);
+    } else {
+        std::snprintf(lines[6], sizeof(lines[6]), "Input-to-fire --");
+    }
+    if (AllocationTracker::Enabled) {
+        auto allocations = [](AllocationTag tag) {
+            return static_cast<unsigned long long>(AllocationTracker::getLastFrame(tag).allocations);
+        };
+        std::snprintf(lines[7], sizeof(lines[7]), "Allocs  update %llu  patterns %llu  render %llu  dialogue %llu  other %llu",
+                      allocations(AllocationTag::SceneUpdate), allocations(AllocationTag::BossPatterns),
+                      allocations(AllocationTag::Render), allocations(AllocationTag::Dialogue), allocations(AllocationTag::Other));
+    } else {
+        std::snprintf(lines[7], sizeof(lines[7]), "Allocs not tracked (build with -DOLDBOW_TRACK_ALLOCATIONS)");
+    }
+
+    mVertices.clear();
+    mIndices.clear();
+    const int margin = 8;
+    const int lineHeight = mAtlas.getLineHeight();
+    SDL_Color white = { 255, 255, 255, 255 };
+    int width = 0;
+    float y = static_cast<float>(mPanel.y + margin);
+    for (const char* line : lines) {
+        mAtlas.appendText(mVertices, mIndices, line, static_cast<float>(mPanel.x + margin), y, white);
+        width = std::max(width, mAtlas.measureText(line));
+        y += lineHeight;
+    }
+    mPanel.w = width + 2 * margin;
+    mPanel.h = static_cast<int>(sizeof(lines) / sizeof(lines[0])) * lineHeight + 2 * margin;
+}
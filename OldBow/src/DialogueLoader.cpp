@@ -0,0 +1,156 @@
+/**
+ * @file DialogueLoader.cpp
+ * @brief DialogueLoader class implementation
+ * Parse dialogue scripts and decode their backgrounds on a worker thread
+ */
+
+#include "DialogueLoader.hpp"
+#include "CompiledAssets.hpp"
+#include "AllocationTracker.hpp"
+#include "Logger.hpp"
+
+/**
+ * @brief Queue a script for loading
+ * @param filePath Path to the dialogue text file
+ */
+void DialogueLoader::request(const std::string& filePath) {
+    if (!mThread) {
+        mMutex = SDL_CreateMutex();
+        mWork = SDL_CreateCond();
+        mThread = SDL_CreateThread(run, "DialogueLoader", this);
+        if (!mThread) {
+            LOG_ERROR("Could not start the dialogue loader: %s", SDL_GetError());
+            return;
+        }
+    }
+    SDL_LockMutex(mMutex);
+    if (mEntries.find(filePath) == mEntries.end()) {
+        mEntries[filePath];  ///< Pending until the worker fills it
+        mQueue.push_back(filePath);
+        SDL_CondSignal(mWork);
+    }
+    SDL_UnlockMutex(mMutex);
+}
+
+/**
+ * @brief Copy the lines of a script that arrived since the last call
+ * @param filePath Path to the dialogue text file
+ * @param lines Lines already received, new lines are appended
+ * @param backgroundPath Set to the script's background path once known
+ * @return True once every line of the script has arrived (or loading failed)
+ */
+bool DialogueLoader::stream(const std::string& filePath, std::vector<std::string>& lines, std::string& backgroundPath) {
+    if (!mThread) {
+        return true;  ///< No worker, nothing will ever arrive
+    }
+    SDL_LockMutex(mMutex);
+    bool complete = true;
+    auto found = mEntries.find(filePath);
+    if (found != mEntries.end()) {
+        const Entry& entry = found -> second;
+        for (size_t i = lines.size(); i < entry.lines.size(); i++) {
+            lines.push_back(entry.lines[i]);
+        }
+        backgroundPath = entry.backgroundPath;
+        complete = entry.complete;
+    }
+    SDL_UnlockMutex(mMutex);
+    return complete;
+}
+
+/**
+ * @brief Take one decoded background image, if any is waiting
+ * @param path Set to the image path
+ * @return Surface now owned by the caller, nullptr if none is waiting
+ */
+SDL_Surface* DialogueLoader::takeBackground(std::string& path) {
+    if (!mThread) {
+        return nullptr;
+    }
+    SDL_Surface* surface = nullptr;
+    SDL_LockMutex(mMutex);
+    if (!mBackgrounds.empty()) {
+        path = std::move(mBackgrounds.back().first);
+        surface = mBackgrounds.back().second;
+        mBackgrounds.pop_back();
+    }
+    SDL_UnlockMutex(mMutex);
+    return surface;
+}
+
+/**
+ * @brief Stop the worker thread and free every surface still waiting
+ */
+void DialogueLoader::shutDown() {
+    if (!mThread) {
+        return;
+    }
+    SDL_LockMutex(mMutex);
+    mStopping = true;
+    SDL_CondSignal(mWork);
+    SDL_UnlockMutex(mMutex);
+    SDL_WaitThread(mThread, nullptr);
+    mThread = nullptr;
+
+    for (auto& background : mBackgrounds) {
+        SDL_FreeSurface(background.second);
+    }
+    mBackgrounds.clear();
+    mEntries.clear();
+    mQueue.clear();
+    mStopping = false;
+    SDL_DestroyCond(mWork);
+    SDL_DestroyMutex(mMutex);
+    mWork = nullptr;
+    mMutex = nullptr;
+}
+
+/**
+ * @brief Worker thread body: load queued scripts until asked to stop
+ * @param data The DialogueLoader that owns this thread
+ */
+int DialogueLoader::run(void* data) {
+    DialogueLoader* self = static_cast<DialogueLoader*>(data);
+    AllocationScope tag(AllocationTag::Dialogue);  ///< Everything this thread allocates is dialogue loading
+    SDL_LockMutex(self -> mMutex);
+    while (true) {
+        while (self -> mQueue.empty() && !self -> mStopping) {
+            SDL_CondWait(self -> mWork, self -> mMutex);
+        }
+        if (self -> mStopping) {
+            break;
+        }
+        std::string filePath = std::move(self -> mQueue.front());
+        self -> mQueue.pop_front();
+        SDL_UnlockMutex(self -> mMutex);
+
+        /// File reads and image decoding happen without the lock, each line is published as it is parsed
+        CompiledAssets::DialogueScript script;
+        auto publishLine = [self, &filePath](const std::string& line) {
+            SDL_LockMutex(self -> mMutex);
+            self -> mEntries[filePath].lines.push_back(line);
+            SDL_UnlockMutex(self -> mMutex);
+        };
+        if (!CompiledAssets::loadDialogue(filePath, script, publishLine)) {
+            LOG_ERROR("Could not open dialogue file: %s", filePath.c_str());
+        }
+        SDL_Surface* background = nullptr;
+        if (!script.backgroundPath.empty()) {
+            background = SDL_LoadBMP(script.backgroundPath.c_str());
+            if (!background) {
+                LOG_ERROR("Error loading BMP file %s: %s", script.backgroundPath.c_str(), SDL_GetError());
+                script.backgroundPath.clear();  ///< Shown without a background, as if it had none
+            }
+        }
+
+        SDL_LockMutex(self -> mMutex);
+        Entry& entry = self -> mEntries[filePath];
+        entry.backgroundPath = script.backgroundPath;
+        entry.complete = true;
+        if (background) {
+            self -> mBackgrounds.emplace_back(script.backgroundPath, background);
+        }
+    }
+    SDL_UnlockMutex(self -> mMutex);
+    return 0;
+}
@@ -7,15 +7,15 @@
 
 #include "DialogueManager.hpp"
 #include "ResourceManager.hpp"
-#include <fstream>
-#include <sstream>
-#include <iostream>
+#include "CompiledAssets.hpp"
+#include "Logger.hpp"
 
 
 /**
- * @brief Load dialogue script and background paths from a text file
- * @details Parses the given text file, extracts dialogue lines and optional background image,
- * and prepares the dialogue manager for sequential display.
+ * @brief Load dialogue script and background paths from a dialogue file
+ * @details Resets the dialogue and asks the background loader for the script (compiled blob
+ * first, text file in dev builds). Lines already loaded, EX: by a prefetch, are taken at once,
+ * the rest arrive through update(). The previous background stays up until the new one is ready.
  * @param filePath Path to the dialogue text file
  * @param onFinish Callback function to execute when dialogue sequence finishes
  * @param renderer SDL renderer used to load the background texture
@@ -31,42 +31,72 @@ void DialogueManager::loadDialogueFromFile(const std::string& filePath,
     mCurrentLineIndex = 0;
     mIsActive = true;
     mOnFinish = onFinish;
-
-    /// Open file in the file path
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
-        std::cerr << "ERROR: Could not open dialogue file: " << filePath << std::endl;
-        return;
+    mScriptPath = filePath;
+    mBackgroundPath.clear();
+    mStreamComplete = false;
+    mBackgroundShown = false;
+    if (renderer) {
+        mRenderer = renderer;
     }
 
-    std::string line;
-    std::string backgroundPath;
-
-    /// Parse each line of the dialogue file
-    while (std::getline(file, line)) {
-        size_t separatorPos = line.find(":");
-        if (separatorPos == std::string::npos) {
-                continue;  ///< Skip lines without a valid key-value separator
-        }
-
-        std::string key = line.substr(0, separatorPos);
-        std::string value = line.substr(separatorPos + 1);
+    /// Parsed in the background, does nothing if the script was prefetched
+    mLoader.request(filePath);
+    pullScript();
+}
 
-        /// Trim leading spaces or tabs from value
-        value.erase(0, value.find_first_not_of(" \t"));
+/**
+ * @brief Start loading scripts that may be needed later
+ * @param filePaths Paths to the dialogue text files
+ * @param renderer SDL renderer used to create the background textures
+ */
+void DialogueManager::prefetch(const std::vector<std::string>& filePaths, SDL_Renderer* renderer) {
+    mRenderer = renderer;
+    for (const std::string& filePath : filePaths) {
+        mLoader.request(filePath);
+    }
+}
 
-        if (key == "background") {
-            backgroundPath = value;  ///< Store background image path
-        } else if (key == "line") {
-            mLines.push_back(value);  ///< Add dialogue line to sequence
+/**
+ * @brief Update dialogue manager state
+ * @details At most one texture is created per frame, so a burst of prefetched backgrounds
+ * is spread over several frames
+ */
+void DialogueManager::update() {
+    std::string path;
+    SDL_Surface* surface = mLoader.takeBackground(path);
+    if (surface) {
+        if (mRenderer) {
+            ResourceManager::AddTexture(path, surface, mRenderer);
+        } else {
+            SDL_FreeSurface(surface);
         }
     }
+    pullScript();
+}
 
-    /// Load background texture if specified
-    if (!backgroundPath.empty() && renderer != nullptr) {
-        currentBackground = ResourceManager::LoadTexture(backgroundPath, renderer);
-    } else {
-        currentBackground = nullptr; // fallback if no background is specified
+/**
+ * @brief Pull newly arrived lines and the background of the current script
+ */
+void DialogueManager::pullScript() {
+    if (!mIsActive || mScriptPath.empty()) {
+        return;
+    }
+    if (!mStreamComplete) {
+        mStreamComplete = mLoader.stream(mScriptPath, mLines, mBackgroundPath);
+    }
+
+    /// Swap the background once the new script's one is known and uploaded
+    if (mStreamComplete) {
+        if (mBackgroundPath.empty()) {
+            currentBackground = nullptr; // fallback if no background is specified
+            mBackgroundShown = true;
+        } else {
+            std::shared_ptr<SDL_Texture> background = ResourceManager::GetCachedTexture(mBackgroundPath);
+            if (background) {
+                currentBackground = background;
+                mBackgroundShown = true;
+            }
+        }
     }
 }
 
@@ -79,6 +109,9 @@ void DialogueManager::loadDialogueFromFile(const std::string& filePath,
 void DialogueManager::nextLine() {
     if (!mIsActive) return;
 
+    /// The next line has not arrived yet, stay on this one
+    if (!mStreamComplete && mCurrentLineIndex + 1 >= static_cast<int>(mLines.size())) return;
+
     mCurrentLineIndex++;
 
     /// Check if dialogue sequence has finished
@@ -107,8 +140,11 @@ bool DialogueManager::isFinished() {
  */
 const std::string& DialogueManager::getCurrentLine() const {
     static const std::string emptyLine = "";
+    if (!mStreamComplete && mCurrentLineIndex >= static_cast<int>(mLines.size())) {
+        return emptyLine;  ///< Still streaming in
+    }
     if (mLines.empty()) {
-        std::cerr << "Warning: getCurrentLine() called but mLines is empty!" << std::endl;
+        LOG_WARNING("getCurrentLine() called but there are no lines");
         return emptyLine;
     }
     return mLines[mCurrentLineIndex];
@@ -126,4 +162,8 @@ void DialogueManager::reset() {
     mIsActive = false;
     mOnFinish = nullptr;
     currentBackground = nullptr;
+    mScriptPath.clear();
+    mBackgroundPath.clear();
+    mStreamComplete = true;
+    mBackgroundShown = true;
 }
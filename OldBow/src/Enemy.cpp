@@ -22,9 +22,16 @@ Enemy::Enemy(float spd, SDL_Renderer* renderer) : GameEntity(spd) {
     mRenderer = renderer;
 
     /// Generate random firing interval between 2000ms and 5000ms
-    static std::mt19937 generator(std::random_device{}());
     std::uniform_real_distribution<float> dist(2000.0f, 5000.0f);
-    minLaunchTime = dist(generator);
+    minLaunchTime = dist(fireIntervalEngine());
+}
+
+/**
+ * @brief Random engine drawing the enemies' firing intervals
+ */
+std::mt19937& Enemy::fireIntervalEngine() {
+    static std::mt19937 generator(std::random_device{}());
+    return generator;
 }
 
 /// @brief Shared movement state variables for all enemies
@@ -35,24 +42,17 @@ float Enemy::movement = 0.0f;          ///< Movement step per frame
 
 /**
  * @brief Update enemy state per frame
- * @details Handles enemy movement, projectile firing logic,
- * and updates owned projectiles and their memory cleanup.
+ * @details Handles enemy movement, and updates owned projectiles and their memory cleanup.
+ * Shots are fired by the scene's timer wheel (see startTimers).
  * @param deltaTime Time elapsed since last frame (in seconds)
  */
 void Enemy::update(float deltaTime) {
-
-    /// Update all attached components (EX: transform, collision)
-    for (auto& component : mComponents) {
-        component.second -> update(deltaTime);
-    }
+    /// The hitbox is moved by the scene's collision pass, transform and texture have no update
     auto ref = GetTransform();
     if (!ref) {
         return;  ///< Exit early if no transform component is attached
     }
 
-    /// Retrieve current game time in milliseconds
-    Uint64 currentTime = SDL_GetTicks();
-
     /// Reverse direction if total movement exceeds threshold
     if (totalEnemyMovement >= movementThreshold) {
         enemyMovingRight = !enemyMovingRight;
@@ -78,67 +78,67 @@ void Enemy::update(float deltaTime) {
         ref -> move(ref -> getX() - movement, ref -> getY());
     }
 
-    /// If enemy is active and ready to fire based on cooldown
-    if (getRenderable() && currentTime - lastFireTime >= minLaunchTime) {
-
-        /// Create and configure new projectile
-        std::shared_ptr<Projectile> newProjectile = std::make_shared<Projectile>(mRenderer);
-        newProjectile -> setIsPlayerProjectile(false);
-        newProjectile -> init();
-
-        /// Create texture for projectile
-        std::shared_ptr<TextureComponent> texture = std::make_shared<TextureComponent>();
-        texture -> CreateTextureComponent(mRenderer, "Assets/Arrow.bmp");
-        newProjectile -> AddComponent(texture); // Add to ECS system
-        newProjectile -> setProjectileMovementType(ProjectileMovementType::UpDown);  // Set the projectile to up and down behavior
-
-        /// Stores the width of enemy to calculate start position
-        newProjectile -> setOwnerWidth(ref -> getWidth());
-
-        /// Attempt to launch projectile
-        if (newProjectile -> Launch(ref -> getX(), ref -> getY(), false, minLaunchTime)) {
-            mProjectiles.push_back(newProjectile);
-            /// Sets the last fire time to current time
-            lastFireTime = currentTime;
-        }
-    }
-
     /// Update all active projectiles
-    for (auto& projectile : mProjectiles) {
-        projectile ->  update(deltaTime);
-    }
+    mProjectiles.update(deltaTime);
 
     /// Clean up inactive or destroyed projectiles
-    for (auto iterator = mProjectiles.begin(); iterator != mProjectiles.end();) {
-        if (!(*iterator) -> getRenderable()) {
-            /**
-             * @brief Remove inactive projectile
-             * @details erase() returns iterator to next valid element
-             */
-            iterator = mProjectiles.erase(iterator);
-        } else {
-            ++iterator;
-        }
-    }
+    mProjectiles.removeInactive();
 }
 
 /**
- * @brief Render the enemy entity and its active projectiles
- * @param renderer SDL renderer used for drawing textures
+ * @brief Register the enemy's attacks on the scene's timer wheel
+ * @param timers Timer wheel of the scene
  */
-void Enemy::render(SDL_Renderer* renderer) {
-
-    /// Render all attached components
-    for (auto& component : mComponents) {
-        component.second -> render(renderer);
-    }
+void Enemy::startTimers(TimerWheel& timers) {
+    scheduleShot(timers, 0.0f);  // First shot as soon as the battle runs
+}
 
-    /// Render all active projectiles owned by the enemy
-    for (auto& projectile : mProjectiles) {
-        if (projectile -> getRenderable()) {
-            projectile -> render(renderer);
+/**
+ * @brief Schedule the next shot on the scene's timer wheel
+ * @details The callback only holds a weak reference, a destroyed enemy's timer fires once and is dropped
+ * @param timers Timer wheel of the scene
+ * @param delay Delay before the shot (in seconds)
+ */
+void Enemy::scheduleShot(TimerWheel& timers, float delay) {
+    std::weak_ptr<Enemy> self = std::static_pointer_cast<Enemy>(shared_from_this());
+    timers.schedule(delay, [self, &timers]() {
+        std::shared_ptr<Enemy> enemy = self.lock();
+        if (!enemy || !enemy -> getRenderable()) {
+            return;  // Dead enemies stop firing
         }
+        enemy -> fire();
+        enemy -> scheduleShot(timers, enemy -> minLaunchTime / 1000.0f);  // minLaunchTime is in milliseconds
+    });
+}
+
+/**
+ * @brief Fire one projectile downward
+ */
+void Enemy::fire() {
+    auto ref = GetTransform();
+    if (!ref) {
+        return;
     }
+
+    /// Create and configure new projectile
+    std::shared_ptr<MinionArrow> newProjectile = SceneArena::makeShared<MinionArrow>();
+    newProjectile -> init();
+
+    /// Create texture for projectile
+    std::shared_ptr<TextureComponent> texture = SceneArena::makeShared<TextureComponent>();
+    texture -> CreateTextureComponent(mRenderer, "Assets/Arrow.bmp");
+    newProjectile -> AddComponent(texture); // Add to ECS system
+
+    /// Resize the arrow and rotate it once to face downward (original texture faces upward)
+    auto arrow = newProjectile -> GetTransform();
+    arrow -> setWidth(8);
+    arrow -> setHeight(26);
+    arrow -> setRotation(180.0f);
+
+    /// Launch it downward at 350 px/s, centered slightly below the enemy (y + 10)
+    float projectileX = (ref -> getWidth() / 2) - (arrow -> getWidth() / 2);
+    newProjectile -> launch(ref -> getX() + projectileX, ref -> getY() + 10, 0.0f, 350.0f);
+    mProjectiles.add(std::move(newProjectile));
 }
 
 /**
@@ -148,11 +148,12 @@ void Enemy::render(SDL_Renderer* renderer) {
  */
 void Enemy::init() {
     /// Create and attach texture component
-    std::shared_ptr<TextureComponent> texture = std::make_shared<TextureComponent>();
+    std::shared_ptr<TextureComponent> texture = SceneArena::makeShared<TextureComponent>();
     texture -> CreateTextureComponent(mRenderer, "Assets/UndeadArchers.bmp");  // Load texture for this enemy
 
-    /// Create and attach collision component
-    std::shared_ptr<Collision2DComponent> hitbox = std::make_shared<Collision2DComponent>();
+    /// Create and attach collision component, enemies are hit by player projectiles
+    std::shared_ptr<Collision2DComponent> hitbox = SceneArena::makeShared<Collision2DComponent>();
+    hitbox -> setLayer(CollisionLayer::Enemy, CollisionLayer::PlayerProjectile);
 
     /// Add default transform component
     AddDefaultTransform();
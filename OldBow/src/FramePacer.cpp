@@ -0,0 +1,170 @@
+/**
+ * @file FramePacer.cpp
+ * @brief FramePacer and FrameTimeHistogram class implementation
+ * Hold the game loop to an exact frame period and record frame times
+ */
+
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <cmath>
+
+#ifdef __linux__
+#include <time.h>
+#endif
+
+/**
+ * @brief Record one frame time
+ * @param milliseconds Frame time in milliseconds
+ */
+void FrameTimeHistogram::add(double milliseconds) {
+    int bucket = static_cast<int>(milliseconds / BucketWidth);
+    bucket = std::max(0, std::min(bucket, BucketCount - 1));
+    mBuckets[bucket]++;
+    mCount++;
+    mTotal += milliseconds;
+}
+
+/**
+ * @brief Get a percentile of the recorded frame times
+ * @param percentile Value between 0 and 100
+ * @return Upper edge of the bucket containing the percentile, in milliseconds
+ */
+double FrameTimeHistogram::getPercentile(double percentile) const {
+    if (mCount == 0) {
+        return 0.0;
+    }
+    /// Rank of the sample we are looking for (1-based)
+    double rank = std::ceil(percentile / 100.0 * mCount);
+    unsigned int target = static_cast<unsigned int>(std::max(1.0, rank));
+    unsigned int seen = 0;
+    for (int i = 0; i < BucketCount; i++) {
+        seen += mBuckets[i];
+        if (seen >= target) {
+            return (i + 1) * BucketWidth;
+        }
+    }
+    return BucketCount * BucketWidth;
+}
+
+/**
+ * @brief Clear all samples
+ */
+void FrameTimeHistogram::reset() {
+    mBuckets.fill(0);
+    mCount = 0;
+    mTotal = 0.0;
+}
+
+/**
+ * @brief Constructor, defaults to 60 FPS without vsync
+ */
+FramePacer::FramePacer() : mFrequency(SDL_GetPerformanceFrequency()) {
+    setTargetFPS(60);
+}
+
+/**
+ * @brief Set the target frame rate
+ * @param fps Frames per second
+ */
+void FramePacer::setTargetFPS(int fps) {
+    if (fps <= 0) {
+        fps = 60;
+    }
+    /// Round to the nearest tick instead of truncating to whole milliseconds
+    mPeriodTicks = (mFrequency + fps / 2) / fps;
+}
+
+/**
+ * @brief Enable or disable vsync-aware pacing
+ * @param enabled True if the renderer presents with vsync
+ * @param refreshRate Display refresh rate in Hz (0 if unknown)
+ */
+void FramePacer::setVSync(bool enabled, int refreshRate) {
+    mVSync = enabled;
+    mRefreshRate = refreshRate;
+}
+
+/**
+ * @brief Start pacing from now
+ */
+void FramePacer::start() {
+    mLastFrameEnd = SDL_GetPerformanceCounter();
+    mNextDeadline = mLastFrameEnd + mPeriodTicks;
+}
+
+/**
+ * @brief Wait until the next frame deadline and record the frame time
+ */
+void FramePacer::waitForNextFrame() {
+    bool presentPaces = mVSync && mRefreshRate > 0 &&
+                        mPeriodTicks * static_cast<Uint64>(mRefreshRate) <= mFrequency;
+
+    if (!presentPaces) {
+        Uint64 deadline = mNextDeadline;
+        if (mVSync && mRefreshRate > 0) {
+            /// Wake half a refresh early so the next present catches the intended vblank
+            deadline -= mFrequency / (2 * static_cast<Uint64>(mRefreshRate));
+        }
+        waitUntil(deadline);
+    }
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    mLastFrameTime = (now - mLastFrameEnd) * 1000.0 / mFrequency;
+    mLastFrameEnd = now;
+    mHistogram.add(mLastFrameTime);
+
+    /**
+     * @brief Schedule the next deadline
+     * @details Deadlines advance by exactly one period so rounding never drifts.
+     * If we fell more than a frame behind (EX: a scene load), resynchronize instead
+     * of rushing several short frames to catch up.
+     */
+    mNextDeadline += mPeriodTicks;
+    if (now > mNextDeadline) {
+        mNextDeadline = now + mPeriodTicks;
+    }
+}
+
+/**
+ * @brief Sleep then spin until the given absolute time
+ * @param deadline Performance counter value to wait for
+ */
+void FramePacer::waitUntil(Uint64 deadline) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    while (now < deadline) {
+        double remaining = static_cast<double>(deadline - now) / mFrequency;
+        double spinTail = std::min(0.002, mSleepOvershoot + 0.0001);
+
+        if (remaining > spinTail) {
+            /// Sleep most of the remaining time, and learn how much the OS overshoots
+            double request = remaining - spinTail;
+            Uint64 before = now;
+            preciseSleep(request);
+            now = SDL_GetPerformanceCounter();
+            double overshoot = static_cast<double>(now - before) / mFrequency - request;
+            mSleepOvershoot += (std::max(0.0, overshoot) - mSleepOvershoot) * 0.1;
+        } else {
+            /// Spin-wait the short tail for sub-millisecond accuracy
+            now = SDL_GetPerformanceCounter();
+        }
+    }
+}
+
+/**
+ * @brief Sleep for approximately the given duration
+ * @param seconds Duration to sleep
+ */
+void FramePacer::preciseSleep(double seconds) {
+#ifdef __linux__
+    timespec request;
+    request.tv_sec = static_cast<time_t>(seconds);
+    request.tv_nsec = static_cast<long>((seconds - request.tv_sec) * 1e9);
+    clock_nanosleep(CLOCK_MONOTONIC, 0, &request, nullptr);
+#else
+    /// SDL_Delay only has millisecond resolution, the spin tail covers the rest
+    Uint32 milliseconds = static_cast<Uint32>(seconds * 1000.0);
+    if (milliseconds > 0) {
+        SDL_Delay(milliseconds);
+    }
+#endif
+}
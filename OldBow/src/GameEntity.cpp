@@ -8,7 +8,6 @@
 #include "TextureComponent.hpp"
 #include "Collision2DComponent.hpp"
 #include "InputComponent.hpp"
-#include <iostream>
 
 /**
  * @brief Constructor
@@ -24,49 +23,11 @@ GameEntity::GameEntity(float spd) : speed(spd), xPositiveDirection(true) {}
  * Move the entity horizontally based on speed and direction
  */
 void GameEntity::update(float deltaTime) {
-    std::shared_ptr<TransformComponent> ref = GetTransform();
+    TransformComponent* ref = GetTransform();
     float movement = (xPositiveDirection ? 1 : - 1) * speed * deltaTime;
     ref -> move(ref -> getX() + movement, ref -> getY());
 }
 
-/**
- * @brief Render entity texture
- * @param renderer SDL renderer
- * Draw the entity's texture component
- */
-void GameEntity::render(SDL_Renderer* renderer) {
-    std::shared_ptr<TextureComponent> texture = GetComponent<TextureComponent>(ComponentType::TextureComponent);
-    if (!texture) {
-        std::cerr << "ERROR: TextureComponent missing in entity!\n";
-        return;
-    }
-
-    texture -> render(renderer);
-}
-
-/**
- * @brief Check collision with another entity
- * @param entity Target entity to check against
- * @return True if collision is detected, false otherwise
- */
-bool GameEntity::TestCollision(std::shared_ptr<GameEntity> entity) {
-    /// Check collision with each entity's hitbox
-    std::shared_ptr<Collision2DComponent> thisHitBox = GetComponent<Collision2DComponent>(ComponentType::Collision2DComponent);
-    std::shared_ptr<Collision2DComponent> otherHitBox = entity -> GetComponent<Collision2DComponent>(ComponentType::Collision2DComponent);
-    if (!thisHitBox || !otherHitBox) {
-        return false; // Null check to avoid crash
-    }
-    SDL_FRect thisRect = thisHitBox -> getRectangle();
-    SDL_FRect otherRect = otherHitBox -> getRectangle();
-
-    /// Returns true if any condition is reached, meaning collision happened between the two entities
-    return !(otherRect.x + otherRect.w <= thisRect.x ||  ///< otherRect is completely to the left of thisRect
-             thisRect.x + thisRect.w <= otherRect.x ||  ///< otherRect is completely to the right of thisRect
-             otherRect.y + otherRect.h <= thisRect.y ||  ///< otherRect is completely above thisRect
-             thisRect.y + thisRect.h <= otherRect.y);   ///< otherRect is completely below thisRect
-}
-
-
 /**
  * @brief Add a component to the entity
  * @tparam T Component type
@@ -77,6 +38,7 @@ void GameEntity::AddComponent(std::shared_ptr<T> component) {
     /// SetGameEntity expects shared_ptr type
     component -> SetGameEntity(GetThisPtr());
     mComponents[component->GetType()] = component;
+    cacheComponent(component.get());
 }
 
 /**
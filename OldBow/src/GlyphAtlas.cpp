@@ -0,0 +1,290 @@
+/**
+ * @file GlyphAtlas.cpp
+ * @brief GlyphAtlas class implementation
+ * Rasterize glyphs once and draw text as batched quads
+ */
+
+#include "GlyphAtlas.hpp"
+#include "RenderStats.hpp"
+#include <SDL_ttf.h>
+
+/**
+ * @brief Destructor, releases the atlas texture
+ */
+GlyphAtlas::~GlyphAtlas() {
+    release();
+}
+
+/**
+ * @brief Rasterize every printable ASCII glyph into one texture
+ * @param renderer SDL renderer that will draw the text
+ * @param fontPath Path to the TTF font
+ * @param pointSize Font size in points
+ * @return True if the atlas is ready to draw
+ */
+bool GlyphAtlas::build(SDL_Renderer* renderer, const std::string& fontPath, int pointSize) {
+    return rasterize(fontPath, pointSize) && upload(renderer);
+}
+
+/**
+ * @brief Rasterize every printable ASCII glyph into the atlas image
+ * @details Glyphs are packed left to right in rows of a 512 px wide surface.
+ * Each glyph cell is a full line high, so drawing a glyph is a plain copy at the pen position.
+ * @param fontPath Path to the TTF font
+ * @param pointSize Font size in points
+ * @return True if the atlas image is ready to upload
+ */
+bool GlyphAtlas::rasterize(const std::string& fontPath, int pointSize) {
+    release();
+
+    TTF_Font* font = TTF_OpenFont(fontPath.c_str(), pointSize);
+    if (!font) {
+        SDL_Log("Failed to load font %s: %s", fontPath.c_str(), TTF_GetError());
+        return false;
+    }
+    mLineHeight = TTF_FontHeight(font);
+
+    /// Rasterize every glyph first so the atlas can be sized to fit
+    const int atlasWidth = 512;
+    const int padding = 1;  ///< Gap between glyphs so linear filtering never bleeds
+    SDL_Color white = { 255, 255, 255, 255 };
+    std::array<SDL_Surface*, LastChar - FirstChar + 1> surfaces{};
+    int penX = 0, penY = 0;
+    for (int c = FirstChar; c <= LastChar; c++) {
+        Glyph& glyph = mGlyphs[c - FirstChar];
+        int minX, maxX, minY, maxY;
+        if (TTF_GlyphMetrics(font, static_cast<Uint16>(c), &minX, &maxX, &minY, &maxY, &glyph.advance) != 0) {
+            glyph.advance = 0;
+        }
+        SDL_Surface* surface = (c == ' ') ? nullptr : TTF_RenderGlyph_Blended(font, static_cast<Uint16>(c), white);
+        surfaces[c - FirstChar] = surface;
+        if (!surface) {
+            continue;
+        }
+        if (penX + surface -> w > atlasWidth) {
+            penX = 0;
+            penY += mLineHeight + padding;
+        }
+        glyph.source = { penX, penY, surface -> w, surface -> h };
+        penX += surface -> w + padding;
+    }
+    TTF_CloseFont(font);
+
+    /// Copy every glyph into the atlas surface, keeping their alpha channel
+    mTextureWidth = atlasWidth;
+    mTextureHeight = penY + mLineHeight + padding;
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, mTextureWidth, mTextureHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (atlas) {
+        SDL_FillRect(atlas, nullptr, SDL_MapRGBA(atlas -> format, 255, 255, 255, 0));
+    }
+    for (int c = FirstChar; c <= LastChar; c++) {
+        SDL_Surface* surface = surfaces[c - FirstChar];
+        if (!surface) {
+            continue;
+        }
+        if (atlas) {
+            SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+            SDL_Rect destination = mGlyphs[c - FirstChar].source;
+            SDL_BlitSurface(surface, nullptr, atlas, &destination);
+        }
+        SDL_FreeSurface(surface);
+    }
+    if (!atlas) {
+        SDL_Log("Failed to create glyph atlas surface: %s", SDL_GetError());
+        return false;
+    }
+    mImage = atlas;
+    return true;
+}
+
+/**
+ * @brief Turn the rasterized atlas image into a texture
+ * @param renderer SDL renderer that will draw the text
+ * @return True if the atlas is ready to draw
+ */
+bool GlyphAtlas::upload(SDL_Renderer* renderer) {
+    if (!mImage) {
+        return mTexture != nullptr;
+    }
+    mTexture = SDL_CreateTextureFromSurface(renderer, mImage);
+    SDL_FreeSurface(mImage);
+    mImage = nullptr;
+    if (!mTexture) {
+        SDL_Log("Failed to create glyph atlas texture: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+/**
+ * @brief Release the atlas texture
+ */
+void GlyphAtlas::release() {
+    if (mImage) {
+        SDL_FreeSurface(mImage);
+        mImage = nullptr;
+    }
+    if (mTexture) {
+        SDL_DestroyTexture(mTexture);
+        mTexture = nullptr;
+    }
+}
+
+/**
+ * @brief Decode the next UTF-8 character and get its glyph
+ * @details Malformed sequences decode one byte at a time and show up as '?'
+ */
+const GlyphAtlas::Glyph& GlyphAtlas::nextGlyph(const std::string& text, size_t& index) const {
+    unsigned char lead = static_cast<unsigned char>(text[index++]);
+    Uint32 code = lead;
+    int continuation = 0;
+    if (lead >= 0xF0) {
+        code = lead & 0x07;
+        continuation = 3;
+    } else if (lead >= 0xE0) {
+        code = lead & 0x0F;
+        continuation = 2;
+    } else if (lead >= 0xC0) {
+        code = lead & 0x1F;
+        continuation = 1;
+    } else if (lead >= 0x80) {
+        code = '?';  ///< Stray continuation byte
+    }
+    for (; continuation > 0 && index < text.size(); continuation--) {
+        unsigned char next = static_cast<unsigned char>(text[index]);
+        if ((next & 0xC0) != 0x80) {
+            code = '?';
+            break;
+        }
+        code = (code << 6) | (next & 0x3F);
+        index++;
+    }
+
+    /// Typographic punctuation used in the dialogue scripts
+    switch (code) {
+        case 0x2013: case 0x2014: code = '-';  break;  ///< En / em dash
+        case 0x2018: case 0x2019: code = '\''; break;  ///< Curly single quotes
+        case 0x201C: case 0x201D: code = '"';  break;  ///< Curly double quotes
+        case 0x00A0:              code = ' ';  break;  ///< Non-breaking space
+        default: break;
+    }
+    if (code < FirstChar || code > LastChar) {
+        code = '?';
+    }
+    return mGlyphs[code - FirstChar];
+}
+
+/**
+ * @brief Measure the width of a string
+ * @param text Text to measure
+ * @return Width in pixels
+ */
+int GlyphAtlas::measureText(const std::string& text) const {
+    int width = 0;
+    for (size_t i = 0; i < text.size();) {
+        width += nextGlyph(text, i).advance;
+    }
+    return width;
+}
+
+/**
+ * @brief Split text into lines that fit a given width
+ * @param text Text to wrap
+ * @param maxWidth Maximum line width in pixels
+ * @return Wrapped lines
+ */
+std::vector<std::string> GlyphAtlas::wrapText(const std::string& text, int maxWidth) const {
+    std::vector<std::string> lines;
+    std::string line;
+    int lineWidth = 0;
+    const int spaceWidth = mGlyphs[' ' - FirstChar].advance;
+
+    size_t start = 0;
+    while (start <= text.size()) {
+        size_t end = text.find(' ', start);
+        if (end == std::string::npos) {
+            end = text.size();
+        }
+        std::string word = text.substr(start, end - start);
+        int wordWidth = measureText(word);
+
+        if (!line.empty() && lineWidth + spaceWidth + wordWidth > maxWidth) {
+            lines.push_back(line);
+            line.clear();
+            lineWidth = 0;
+        }
+        if (!word.empty()) {
+            if (!line.empty()) {
+                line += ' ';
+                lineWidth += spaceWidth;
+            }
+            line += word;
+            lineWidth += wordWidth;
+        }
+        start = end + 1;
+    }
+    if (!line.empty()) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/**
+ * @brief Append word wrapped text to a vertex list
+ * @return Number of lines used
+ */
+int GlyphAtlas::appendWrappedText(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices,
+                                  const std::string& text, float x, float y, int maxWidth, SDL_Color color) const {
+    std::vector<std::string> lines = wrapText(text, maxWidth);
+    for (const std::string& line : lines) {
+        appendText(vertices, indices, line, x, y, color);
+        y += mLineHeight;
+    }
+    return static_cast<int>(lines.size());
+}
+
+/**
+ * @brief Append the quads for a string to a vertex list
+ * @details Spaces only advance the pen, every other glyph adds one textured quad
+ */
+void GlyphAtlas::appendText(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices,
+                            const std::string& text, float x, float y, SDL_Color color) const {
+    if (!mTexture) {
+        return;
+    }
+    float penX = x;
+    float inverseWidth = 1.0f / mTextureWidth;
+    float inverseHeight = 1.0f / mTextureHeight;
+    for (size_t i = 0; i < text.size();) {
+        const Glyph& glyph = nextGlyph(text, i);
+        if (glyph.source.w > 0) {
+            float left = glyph.source.x * inverseWidth;
+            float top = glyph.source.y * inverseHeight;
+            float right = (glyph.source.x + glyph.source.w) * inverseWidth;
+            float bottom = (glyph.source.y + glyph.source.h) * inverseHeight;
+            int base = static_cast<int>(vertices.size());
+
+            vertices.push_back({ { penX, y }, color, { left, top } });
+            vertices.push_back({ { penX + glyph.source.w, y }, color, { right, top } });
+            vertices.push_back({ { penX + glyph.source.w, y + glyph.source.h }, color, { right, bottom } });
+            vertices.push_back({ { penX, y + glyph.source.h }, color, { left, bottom } });
+
+            int quad[6] = { base, base + 1, base + 2, base, base + 2, base + 3 };
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+        penX += glyph.advance;
+    }
+}
+
+/**
+ * @brief Draw a prepared vertex list with one draw call
+ */
+void GlyphAtlas::draw(SDL_Renderer* renderer, const std::vector<SDL_Vertex>& vertices, const std::vector<int>& indices) const {
+    if (!mTexture || indices.empty()) {
+        return;
+    }
+    SDL_RenderGeometry(renderer, mTexture, vertices.data(), static_cast<int>(vertices.size()),
+                       indices.data(), static_cast<int>(indices.size()));
+    RenderStats::drawCalls++;
+}
@@ -5,9 +5,10 @@
  */
 
 #include "InputComponent.hpp"
+#include "InputQueue.hpp"
 #include "TextureComponent.hpp"
 #include "Player.hpp"
-#include "Projectile.hpp"
+#include "ProjectileList.hpp"
 
 
 /**
@@ -20,7 +21,8 @@ InputComponent::InputComponent(float speed, SDL_Renderer* renderer) : mSpeed(spe
 /**
  * @brief Handle user input
  * @param deltaTime Time elapsed since last frame
- * Process movement keys and spacebar for shooting
+ * Replay this frame's key events in order: move for the time between events,
+ * and fire on every spacebar press at the moment it happened
  */
 void InputComponent::input(float deltaTime) {
     auto ref = GetGameEntity() -> GetTransform();
@@ -28,54 +30,102 @@ void InputComponent::input(float deltaTime) {
         return; ///< Skip if no transform component
     }
 
-    /// Move left
-    const Uint8* keystate = SDL_GetKeyboardState(NULL); ///< Access keyboard state
-    if (keystate[SDL_SCANCODE_A] || keystate[SDL_SCANCODE_LEFT]) {
-        ref -> move(ref -> getX() - mSpeed * deltaTime, ref -> getY()); // move left
-    }
-
-    /// Move right
-    if (keystate[SDL_SCANCODE_D] || keystate[SDL_SCANCODE_RIGHT]) {
-        ref -> move(ref -> getX() + mSpeed * deltaTime, ref -> getY()); // move right
-    }
-
-    /// Shoot projectile
-    if (keystate[SDL_SCANCODE_SPACE]) {
-
-        /// Prevent rapid fire from holding space
-        if (!spacebarPressed) {
-            spacebarPressed = true; // Mark space bar as pressed
+    /// Key state at the start of the frame, updated as events are replayed
+    bool leftA = inputQueue.wasHeldAtFrameStart(SDL_SCANCODE_A);
+    bool leftArrow = inputQueue.wasHeldAtFrameStart(SDL_SCANCODE_LEFT);
+    bool rightD = inputQueue.wasHeldAtFrameStart(SDL_SCANCODE_D);
+    bool rightArrow = inputQueue.wasHeldAtFrameStart(SDL_SCANCODE_RIGHT);
 
-            /// Cast to Player to access AddProjectiles
-            std::shared_ptr<Player> player = std::static_pointer_cast<Player>(GetGameEntity());
-
-            auto ref = player -> GetTransform();
-            if(!ref) {
-                return;
-            }
-
-            /// Create a new projectile
-            std::shared_ptr<Projectile> newProjectile = std::make_shared<Projectile>(mRenderer);
-            newProjectile -> init();
-            newProjectile -> setProjectileMovementType(ProjectileMovementType::UpDown);
-
-            /// Assign texture
-            std::shared_ptr<TextureComponent> playerProjectileTexture = std::make_shared<TextureComponent>();
-            playerProjectileTexture -> CreateTextureComponent(mRenderer, "Assets/arrow.bmp");  // change to your texture
-            newProjectile ->AddComponent(playerProjectileTexture);
-
-            newProjectile -> setIsPlayerProjectile(true);
-            newProjectile -> setOwnerWidth(ref -> getWidth());
-            newProjectile -> setProjectileSpeed(1000.0f);
+    /// Move the player for a slice of the frame using the keys held during that slice
+    auto moveFor = [&](float seconds) {
+        if (seconds <= 0.0f) {
+            return;
+        }
+        if (leftA || leftArrow) {
+            ref -> move(ref -> getX() - mSpeed * seconds, ref -> getY()); // move left
+        }
+        if (rightD || rightArrow) {
+            ref -> move(ref -> getX() + mSpeed * seconds, ref -> getY()); // move right
+        }
+    };
+
+    /**
+     * @brief Replay events at their position inside the frame
+     * @details The frame covers [frameTime - deltaTime, frameTime]. Each event is placed at
+     * (deltaTime - age), clamped into the frame in case its timestamp is older than the frame.
+     */
+    Uint32 frameTime = inputQueue.getFrameTime();
+    float cursor = 0.0f;  ///< Seconds into the frame already simulated
+    for (const InputEvent& event : inputQueue.getEvents()) {
+        float age = static_cast<Sint32>(frameTime - event.timestamp) / 1000.0f;
+        float eventTime = deltaTime - age;
+        if (eventTime < cursor) {
+            eventTime = cursor;
+        } else if (eventTime > deltaTime) {
+            eventTime = deltaTime;
+        }
 
-            /// Launch projectile and add to player projectiles if successful
-            if (newProjectile -> Launch(ref -> getX(), ref -> getY(), true)) {
-                player -> AddProjectiles(newProjectile);
-            }
+        moveFor(eventTime - cursor);
+        cursor = eventTime;
+
+        switch (event.scancode) {
+            case SDL_SCANCODE_A:     leftA = event.pressed;      break;
+            case SDL_SCANCODE_LEFT:  leftArrow = event.pressed;  break;
+            case SDL_SCANCODE_D:     rightD = event.pressed;     break;
+            case SDL_SCANCODE_RIGHT: rightArrow = event.pressed; break;
+            case SDL_SCANCODE_SPACE:
+                /// Every press fires once, even if it was released within the same frame
+                if (event.pressed) {
+                    fire(eventTime, event.timestamp);
+                }
+                break;
+            default:
+                break;
         }
-    } else {
-        spacebarPressed = false;  ///< Reset flag when space bar is released
     }
+    /// Finish the frame with the final key state
+    moveFor(deltaTime - cursor);
 }
 
+/**
+ * @brief Fire a projectile from the player's current position
+ * @param subStepOffset Seconds into the frame at which the key was pressed
+ * @param pressTime SDL timestamp of the key press
+ */
+void InputComponent::fire(float subStepOffset, Uint32 pressTime) {
+    /// Cast to Player to access AddProjectiles
+    std::shared_ptr<Player> player = std::static_pointer_cast<Player>(GetGameEntity());
 
+    auto ref = player -> GetTransform();
+    if(!ref) {
+        return;
+    }
+
+    /// Nothing is fired until the last arrow has reloaded
+    Uint64 currentTime = SDL_GetTicks();
+    if (currentTime - mLastFireTime < FireInterval) {
+        return;
+    }
+    mLastFireTime = currentTime;
+
+    /// Create a new projectile
+    std::shared_ptr<PlayerArrow> newProjectile = SceneArena::makeShared<PlayerArrow>();
+    newProjectile -> init();
+
+    /// Assign texture
+    std::shared_ptr<TextureComponent> playerProjectileTexture = SceneArena::makeShared<TextureComponent>();
+    playerProjectileTexture -> CreateTextureComponent(mRenderer, "Assets/arrow.bmp");  // change to your texture
+    newProjectile ->AddComponent(playerProjectileTexture);
+
+    /// Resize the arrow, then launch it upward centered slightly above the player (y - 10)
+    auto arrow = newProjectile -> GetTransform();
+    arrow -> setWidth(15);
+    arrow -> setHeight(40);
+    float projectileX = (ref -> getWidth() / 2) - (arrow -> getWidth() / 2);
+    newProjectile -> launch(ref -> getX() + projectileX, ref -> getY() - 10, 0.0f, -1000.0f);
+
+    /// Only travel for the part of the frame after the key press
+    newProjectile -> setSubStepOffset(subStepOffset);
+    player -> AddProjectiles(newProjectile);
+    inputQueue.recordFireLatency(static_cast<float>(SDL_GetTicks() - pressTime));
+}
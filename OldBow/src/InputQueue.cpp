@@ -0,0 +1,47 @@
+/**
+ * @file InputQueue.cpp
+ * @brief InputQueue class implementation
+ * Collect timestamped keyboard events and input latency metrics
+ */
+
+#include "InputQueue.hpp"
+
+/// Global input queue
+InputQueue inputQueue;
+
+/**
+ * @brief Start collecting a new frame of events
+ * @param frameTime Time (SDL ticks) at which the frame's input is sampled
+ */
+void InputQueue::beginFrame(Uint32 frameTime) {
+    mEvents.clear();
+    mHeldAtFrameStart = mHeld;
+    mFrameTime = frameTime;
+}
+
+/**
+ * @brief Queue a keyboard event and update the key state
+ * @param key Keyboard event from SDL_PollEvent
+ */
+void InputQueue::push(const SDL_KeyboardEvent& key) {
+    /// Holding a key generates repeat events, those are not new presses
+    if (key.repeat) {
+        return;
+    }
+    bool pressed = key.state == SDL_PRESSED;
+    mHeld[key.keysym.scancode] = pressed;
+    mEvents.push_back({key.keysym.scancode, pressed, key.timestamp});
+}
+
+/**
+ * @brief Record the latency between a fire key press and the projectile launch
+ * @param milliseconds Measured latency
+ */
+void InputQueue::recordFireLatency(float milliseconds) {
+    mLastFireLatency = milliseconds;
+    if (mAverageFireLatency < 0.0f) {
+        mAverageFireLatency = milliseconds;  ///< First sample seeds the average
+    } else {
+        mAverageFireLatency += (milliseconds - mAverageFireLatency) * 0.1f;
+    }
+}
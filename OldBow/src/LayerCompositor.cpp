@@ -0,0 +1,293 @@
+/**
+ * @file LayerCompositor.cpp
+ * @brief LayerCompositor class implementation
+ * Cache the background layer, redraw only the moving parts of the gameplay layer, and put it on the window
+ */
+
+#include "LayerCompositor.hpp"
+#include "FrameSnapshot.hpp"
+#include "RenderStats.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Check if a texture has no alpha channel, so nothing under it shows through
+ */
+static bool isOpaque(SDL_Texture* texture) {
+    Uint32 format = 0;
+    if (SDL_QueryTexture(texture, &format, nullptr, nullptr, nullptr) != 0) {
+        return false;
+    }
+    return !SDL_ISPIXELFORMAT_ALPHA(format);
+}
+
+/**
+ * @brief Check if the window shows bars around the play field
+ */
+static bool isLetterboxed(SDL_Renderer* renderer, int logicalWidth, int logicalHeight) {
+    int width = 0, height = 0;
+    SDL_GetRendererOutputSize(renderer, &width, &height);
+    return width * logicalHeight != height * logicalWidth;
+}
+
+/**
+ * @brief Draw the particles of one emitter with a single geometry call
+ */
+static void drawParticles(SDL_Renderer* renderer, const ParticleBatch& batch) {
+    if (!batch.texture || batch.vertices.empty()) {
+        return;
+    }
+    SDL_RenderGeometry(renderer, batch.texture, batch.vertices.data(), static_cast<int>(batch.vertices.size()),
+                       batch.indices.data(), batch.getIndexCount());
+    RenderStats::drawCalls++;
+}
+
+/**
+ * @brief Create the layer targets
+ * @param renderer SDL renderer
+ * @param logicalWidth Width of the play field in logical coordinates
+ * @param logicalHeight Height of the play field in logical coordinates
+ * @return True if layers are cached in render targets
+ */
+bool LayerCompositor::init(SDL_Renderer* renderer, int logicalWidth, int logicalHeight) {
+    mLogicalWidth = logicalWidth;
+    mLogicalHeight = logicalHeight;
+    if (!SDL_RenderTargetSupported(renderer)) {
+        SDL_Log("Render targets not supported, drawing straight to the window");
+        return false;
+    }
+    mBackground = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, logicalWidth, logicalHeight);
+    mGameplay = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, logicalWidth, logicalHeight);
+    if (!mBackground || !mGameplay) {
+        SDL_Log("Failed to create the layer targets: %s", SDL_GetError());
+        shutDown();
+        return false;
+    }
+    /// Layers are opaque: copies overwrite instead of blending
+    SDL_SetTextureBlendMode(mBackground, SDL_BLENDMODE_NONE);
+    SDL_SetTextureBlendMode(mGameplay, SDL_BLENDMODE_NONE);
+    SDL_SetTextureScaleMode(mGameplay, SDL_ScaleModeLinear);  ///< Smooth upscale
+    setScale(1.0f);
+
+    /// Dirty tiles cover the full resolution, lower scales use the top left part of the grid
+    mTileColumns = (logicalWidth + TileSize - 1) / TileSize;
+    mTileRows = (logicalHeight + TileSize - 1) / TileSize;
+    mDirtyTiles.assign(static_cast<size_t>(mTileColumns) * mTileRows, 0);
+    mDirtyTileCount = 0;
+    return true;
+}
+
+/**
+ * @brief Bring the layers up to date with a frame and put them on the window
+ * @param renderer SDL renderer
+ * @param frame Snapshot of the frame to draw
+ * @param scale Resolution scale of the layers (1 is the full logical resolution)
+ */
+void LayerCompositor::composite(SDL_Renderer* renderer, const FrameSnapshot& frame, float scale) {
+    /// No targets: background and sprites go straight to the window at full resolution
+    if (!mGameplay) {
+        drawBackground(renderer, frame, true);
+        for (const SpriteCommand& sprite : frame.sprites) {
+            SDL_RenderCopyExF(renderer, sprite.texture, NULL, &sprite.rect, sprite.rotation, NULL, SDL_FLIP_NONE);
+            RenderStats::drawCalls++;
+        }
+        for (const ParticleBatch& batch : frame.particles) {
+            drawParticles(renderer, batch);
+        }
+        return;
+    }
+
+    /// A new resolution changes every pixel of both layers
+    if (scale != mScale) {
+        setScale(scale);
+        invalidate();
+    }
+
+    /// Background layer: redrawn only when its textures change
+    if (!mBackgroundValid || frame.dialogueBackground != mDialogueBackground || frame.background != mBattleBackground) {
+        SDL_SetRenderTarget(renderer, mBackground);
+        SDL_RenderSetScale(renderer, mScale, mScale);
+        drawBackground(renderer, frame, false);
+        mDialogueBackground = frame.dialogueBackground;
+        mBattleBackground = frame.background;
+        mBackgroundValid = true;
+        mGameplayValid = false;
+    }
+
+    /// Gameplay layer: put the background back where the last sprites were, then draw the new ones
+    SDL_SetRenderTarget(renderer, mGameplay);
+    SDL_RenderSetScale(renderer, 1.0f, 1.0f);
+    if (!mGameplayValid) {
+        SDL_RenderCopy(renderer, mBackground, &mUsed, &mUsed);
+        RenderStats::drawCalls++;
+        mGameplayValid = true;
+    } else {
+        restoreDirty(renderer);
+    }
+    std::fill(mDirtyTiles.begin(), mDirtyTiles.end(), 0);
+    mDirtyTileCount = 0;
+    SDL_RenderSetScale(renderer, mScale, mScale);
+    for (const SpriteCommand& sprite : frame.sprites) {
+        SDL_RenderCopyExF(renderer, sprite.texture, NULL, &sprite.rect, sprite.rotation, NULL, SDL_FLIP_NONE);
+        RenderStats::drawCalls++;
+        markDirty(sprite.rect, sprite.rotation);
+    }
+    for (const ParticleBatch& batch : frame.particles) {
+        drawParticles(renderer, batch);
+        for (size_t i = 0; i + 3 < batch.vertices.size(); i += 4) {
+            const SDL_FPoint& topLeft = batch.vertices[i].position;
+            const SDL_FPoint& bottomRight = batch.vertices[i + 2].position;
+            markArea(topLeft.x, topLeft.y, bottomRight.x, bottomRight.y);
+        }
+    }
+
+    /// Back to the window (its logical size is restored): the one full screen copy of the frame
+    SDL_SetRenderTarget(renderer, nullptr);
+    if (isLetterboxed(renderer, mLogicalWidth, mLogicalHeight)) {
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderClear(renderer);
+    }
+    SDL_RenderCopy(renderer, mGameplay, &mUsed, nullptr);
+    RenderStats::drawCalls++;
+}
+
+/**
+ * @brief Draw the visible background textures of a frame, skipping those under an opaque one
+ * @param renderer SDL renderer
+ * @param frame Snapshot of the frame to draw
+ * @param toWindow True when drawing straight to the window, which may show bars around the play field
+ */
+void LayerCompositor::drawBackground(SDL_Renderer* renderer, const FrameSnapshot& frame, bool toWindow) {
+    /// Bottom to top: the dialogue background, then the battle background
+    SDL_Texture* layers[] = { frame.dialogueBackground, frame.background };
+    const int layerCount = static_cast<int>(sizeof(layers) / sizeof(layers[0]));
+
+    /// Start at the topmost opaque layer, everything under it would be overdrawn
+    int first = 0;
+    for (int i = layerCount - 1; i >= 0; i--) {
+        if (layers[i] && isOpaque(layers[i])) {
+            first = i;
+            break;
+        }
+    }
+    bool covered = layers[first] && isOpaque(layers[first]);
+    if (!covered || (toWindow && isLetterboxed(renderer, mLogicalWidth, mLogicalHeight))) {
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderClear(renderer);
+    }
+    /// Explicit play field rectangle: with a scale set, a null rectangle would cover the whole target
+    SDL_Rect field = { 0, 0, mLogicalWidth, mLogicalHeight };
+    for (int i = first; i < layerCount; i++) {
+        if (layers[i]) {
+            SDL_RenderCopy(renderer, layers[i], nullptr, &field);
+            RenderStats::drawCalls++;
+        }
+    }
+}
+
+/**
+ * @brief Set the resolution scale and the part of the targets it uses
+ * @param scale Resolution scale (1 is the full logical resolution)
+ */
+void LayerCompositor::setScale(float scale) {
+    mScale = scale;
+    mUsed = { 0, 0,
+              static_cast<int>(std::lround(mLogicalWidth * mScale)),
+              static_cast<int>(std::lround(mLogicalHeight * mScale)) };
+}
+
+/**
+ * @brief Restore the tiles under the previous frame's sprites and particles from the background layer
+ * @details Each row of tiles is restored with one copy per run of dirty tiles. When most of the
+ * layer is dirty, one copy of the whole layer is cheaper than many small ones.
+ */
+void LayerCompositor::restoreDirty(SDL_Renderer* renderer) {
+    if (mDirtyTileCount == 0) {
+        return;
+    }
+    if (static_cast<long long>(mDirtyTileCount) * TileSize * TileSize * 4 >= static_cast<long long>(mUsed.w) * mUsed.h * 3) {
+        SDL_RenderCopy(renderer, mBackground, &mUsed, &mUsed);
+        RenderStats::drawCalls++;
+        return;
+    }
+    for (int row = 0; row < mTileRows; row++) {
+        const Uint8* tiles = &mDirtyTiles[static_cast<size_t>(row) * mTileColumns];
+        for (int column = 0; column < mTileColumns;) {
+            if (!tiles[column]) {
+                column++;
+                continue;
+            }
+            int first = column;
+            while (column < mTileColumns && tiles[column]) {
+                column++;
+            }
+            SDL_Rect run = { first * TileSize, row * TileSize, (column - first) * TileSize, TileSize };
+            SDL_IntersectRect(&run, &mUsed, &run);
+            SDL_RenderCopy(renderer, mBackground, &run, &run);
+            RenderStats::drawCalls++;
+        }
+    }
+}
+
+/**
+ * @brief Mark the tiles covered by a sprite as dirty
+ * @details Rotated sprites cover the bounding box of the rotated rectangle
+ * @param rect Sprite rectangle in logical coordinates
+ * @param rotation Rotation around the rectangle's center in degrees
+ */
+void LayerCompositor::markDirty(const SDL_FRect& rect, double rotation) {
+    float left = rect.x, top = rect.y, right = rect.x + rect.w, bottom = rect.y + rect.h;
+    if (rotation != 0.0) {
+        double radians = rotation * 3.14159265358979 / 180.0;
+        float cosine = static_cast<float>(std::fabs(std::cos(radians)));
+        float sine = static_cast<float>(std::fabs(std::sin(radians)));
+        float halfWidth = (rect.w * cosine + rect.h * sine) * 0.5f;
+        float halfHeight = (rect.w * sine + rect.h * cosine) * 0.5f;
+        float centerX = rect.x + rect.w * 0.5f;
+        float centerY = rect.y + rect.h * 0.5f;
+        left = centerX - halfWidth;
+        right = centerX + halfWidth;
+        top = centerY - halfHeight;
+        bottom = centerY + halfHeight;
+    }
+    markArea(left, top, right, bottom);
+}
+
+/**
+ * @brief Mark the tiles under an area as dirty
+ * @details Widened by a pixel on each side for the linear filtering of sprite edges
+ * @param left Left edge in logical coordinates
+ * @param top Top edge in logical coordinates
+ * @param right Right edge in logical coordinates
+ * @param bottom Bottom edge in logical coordinates
+ */
+void LayerCompositor::markArea(float left, float top, float right, float bottom) {
+    int x0 = std::max(0, static_cast<int>(std::floor(left * mScale)) - 1);
+    int y0 = std::max(0, static_cast<int>(std::floor(top * mScale)) - 1);
+    int x1 = std::min(mUsed.w, static_cast<int>(std::ceil(right * mScale)) + 1);
+    int y1 = std::min(mUsed.h, static_cast<int>(std::ceil(bottom * mScale)) + 1);
+    if (x1 <= x0 || y1 <= y0) {
+        return;
+    }
+    for (int row = y0 / TileSize; row <= (y1 - 1) / TileSize; row++) {
+        Uint8* tiles = &mDirtyTiles[static_cast<size_t>(row) * mTileColumns];
+        for (int column = x0 / TileSize; column <= (x1 - 1) / TileSize; column++) {
+            mDirtyTileCount += !tiles[column];
+            tiles[column] = 1;
+        }
+    }
+}
+
+/**
+ * @brief Release the targets, call before the renderer is destroyed
+ */
+void LayerCompositor::shutDown() {
+    if (mBackground) {
+        SDL_DestroyTexture(mBackground);
+        mBackground = nullptr;
+    }
+    if (mGameplay) {
+        SDL_DestroyTexture(mGameplay);
+        mGameplay = nullptr;
+    }
+}
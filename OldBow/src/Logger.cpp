@@ -0,0 +1,233 @@
+/**
+ * @file Logger.cpp
+ * @brief Logger class implementation
+ * Queue messages in a lock-free ring buffer and write them to stderr on a background thread
+ */
+
+#include "Logger.hpp"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+/// One queued message
+struct LogRecord {
+    LogLevel level;
+    Uint32 ticks;        ///< SDL ticks when the message was logged
+    const char* file;
+    int line;
+    Uint32 suppressed;   ///< Messages of the same call site dropped before this one
+    char text[160];
+};
+
+/// Slot of the ring buffer, the sequence number tells whose turn it is
+struct LogSlot {
+    std::atomic<Uint32> sequence{0};
+    LogRecord record;
+};
+
+/// Ring buffer size, a power of two
+static const Uint32 Capacity = 256;
+static const Uint32 Mask = Capacity - 1;
+
+static LogSlot slots[Capacity];
+static std::atomic<Uint32> enqueuePosition{0};
+static Uint32 dequeuePosition = 0;           ///< Flush thread only
+static std::atomic<Uint32> droppedCount{0};  ///< Messages lost to a full buffer
+static std::atomic<int> minimumLevel{static_cast<int>(LogLevel::Info)};
+static std::atomic<bool> running{false};
+static std::atomic<bool> stopping{false};
+static SDL_Thread* flushThread = nullptr;
+static SDL_sem* pending = nullptr;           ///< Posted once per queued message
+
+/**
+ * @brief Display name of a severity
+ */
+static const char* levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Debug:   return "DEBUG";
+        case LogLevel::Info:    return "INFO";
+        case LogLevel::Warning: return "WARNING";
+        case LogLevel::Error:   return "ERROR";
+    }
+    return "?";
+}
+
+/**
+ * @brief Write one message to stderr
+ */
+static void print(const LogRecord& record) {
+    const char* file = std::strrchr(record.file, '/');
+    const char* windowsFile = std::strrchr(record.file, '\\');
+    if (windowsFile > file) {
+        file = windowsFile;
+    }
+    file = file ? file + 1 : record.file;
+    std::fprintf(stderr, "[%7.3f] %s %s:%d: %s", record.ticks / 1000.0, levelName(record.level), file, record.line, record.text);
+    if (record.suppressed > 0) {
+        std::fprintf(stderr, " (%u similar messages suppressed)", static_cast<unsigned>(record.suppressed));
+    }
+    std::fputc('\n', stderr);
+}
+
+/**
+ * @brief Claim a free slot, lock-free for any number of producers
+ * @return Slot to fill, nullptr if the buffer is full
+ */
+static LogSlot* claimSlot(Uint32& position) {
+    position = enqueuePosition.load(std::memory_order_relaxed);
+    while (true) {
+        LogSlot& slot = slots[position & Mask];
+        Sint32 difference = static_cast<Sint32>(slot.sequence.load(std::memory_order_acquire) - position);
+        if (difference == 0) {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                return &slot;
+            }
+        } else if (difference < 0) {
+            return nullptr;  ///< The flush thread has not written this slot yet
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Write every message queued so far, flush thread only
+ */
+static void drain() {
+    while (true) {
+        LogSlot& slot = slots[dequeuePosition & Mask];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) {
+            break;
+        }
+        print(slot.record);
+        slot.sequence.store(dequeuePosition + Capacity, std::memory_order_release);
+        dequeuePosition++;
+    }
+    Uint32 dropped = droppedCount.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        std::fprintf(stderr, "[%7.3f] WARNING Logger: %u messages dropped, log buffer full\n",
+                     SDL_GetTicks() / 1000.0, static_cast<unsigned>(dropped));
+    }
+    std::fflush(stderr);
+}
+
+/**
+ * @brief Flush thread body: write messages as they arrive until asked to stop
+ */
+static int runFlush(void*) {
+    while (!stopping.load(std::memory_order_acquire)) {
+        SDL_SemWaitTimeout(pending, 100);
+        drain();
+    }
+    drain();
+    return 0;
+}
+
+/**
+ * @brief Start the flush thread
+ * @details Without a thread, messages keep going straight to stderr
+ */
+void Logger::start() {
+    if (running) {
+        return;
+    }
+    for (Uint32 i = 0; i < Capacity; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    enqueuePosition.store(0, std::memory_order_relaxed);
+    dequeuePosition = 0;
+    stopping = false;
+    pending = SDL_CreateSemaphore(0);
+    flushThread = pending ? SDL_CreateThread(runFlush, "Logger", nullptr) : nullptr;
+    if (!flushThread) {
+        std::fprintf(stderr, "Could not start the logger thread, logging synchronously: %s\n", SDL_GetError());
+        if (pending) {
+            SDL_DestroySemaphore(pending);
+            pending = nullptr;
+        }
+        return;
+    }
+    running.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Write every queued message and stop the flush thread
+ * @details Call once no other thread logs anymore
+ */
+void Logger::shutDown() {
+    if (!running) {
+        return;
+    }
+    running.store(false, std::memory_order_release);
+    stopping.store(true, std::memory_order_release);
+    SDL_SemPost(pending);
+    SDL_WaitThread(flushThread, nullptr);
+    flushThread = nullptr;
+    SDL_DestroySemaphore(pending);
+    pending = nullptr;
+}
+
+/**
+ * @brief Drop messages below a severity
+ * @param level Lowest severity written
+ */
+void Logger::setLevel(LogLevel level) {
+    minimumLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Queue a message
+ * @details The rate limit is checked before formatting, a suppressed message costs a few atomics
+ * @param site Call site the message comes from
+ * @param level Severity
+ * @param format printf-style format
+ */
+void Logger::write(LogSite& site, LogLevel level, const char* format, ...) {
+    if (static_cast<int>(level) < minimumLevel.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    /// Per call site rate limit: start a new window once the current one is over
+    Uint32 now = SDL_GetTicks();
+    Uint32 windowStart = site.windowStart.load(std::memory_order_relaxed);
+    if (now - windowStart >= RateWindowMs &&
+        site.windowStart.compare_exchange_strong(windowStart, now, std::memory_order_relaxed)) {
+        site.inWindow.store(0, std::memory_order_relaxed);
+    }
+    if (site.inWindow.fetch_add(1, std::memory_order_relaxed) >= MaxPerWindow) {
+        site.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    LogRecord local;
+    LogRecord* record = &local;
+    LogSlot* slot = nullptr;
+    Uint32 position = 0;
+    bool queued = running.load(std::memory_order_acquire);
+    if (queued) {
+        slot = claimSlot(position);
+        if (!slot) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            site.suppressed.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        record = &slot -> record;
+    }
+
+    record -> level = level;
+    record -> ticks = now;
+    record -> file = site.file;
+    record -> line = site.line;
+    record -> suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+    va_list arguments;
+    va_start(arguments, format);
+    std::vsnprintf(record -> text, sizeof(record -> text), format, arguments);
+    va_end(arguments);
+
+    if (!queued) {
+        print(local);  ///< No flush thread (start up, shut down), write it now
+        return;
+    }
+    slot -> sequence.store(position + 1, std::memory_order_release);
+    SDL_SemPost(pending);
+}
@@ -29,60 +29,25 @@ Player::Player(float spd, SDL_Renderer* renderer) : GameEntity(spd) {
  * @param deltaTime Time elapsed since last frame (in seconds)
  */
 void Player::input(float deltaTime) {
-    /// Loop through each component of the Player and process input
-    for (auto& component : mComponents) {
-        component.second -> input(deltaTime);
+    /// Only the InputComponent reacts to input, call it directly
+    if (mInput) {
+        mInput -> input(deltaTime);
     }
 }
 
 
 /**
  * @brief Update player state and projectiles
- * @details Updates all player components and active projectiles.
- * Cleans up memory for inactive projectiles.
+ * @details Updates all active projectiles and cleans up memory for inactive ones.
+ * The hitbox is moved by the scene's collision pass, the other components have no update.
  * @param deltaTime Time elapsed since last frame (in seconds)
  */
 void Player::update(float deltaTime) {
-    /// Update all attached components (transform, collision, input)
-    for (auto& component : mComponents) {
-        component.second -> update(deltaTime);
-    }
-
     /// Update all active projectiles owned by player
-    for (auto& projectile : getPlayerProjectiles()) {
-        // Update
-        projectile -> update(deltaTime);
-    }
+    mProjectiles.update(deltaTime);
 
     /// Clean up inactive projectiles
-    for (auto iterator = mProjectiles.begin(); iterator != mProjectiles.end();) {
-        if (!(*iterator) -> getRenderable()) {
-            /// Remove the inactive projectile and advance iterator
-            iterator = mProjectiles.erase(iterator);  ///< erase() returns the next valid iterator
-        } else {
-            ++iterator;  ///< Move to next projectile
-        }
-    }
-}
-
-/**
- * @brief Render the player and their projectiles
- * @details Renders all attached components (such as the player's texture),
- * as well as all active projectiles fired by the player.
- * @param renderer SDL renderer used for rendering textures
- */
-void Player::render(SDL_Renderer* renderer) {
-
-    /// Render all player components
-    for (auto& component : mComponents) {
-        component.second -> render(renderer);
-    }
-
-    /// Render all player projectiles
-    for (auto& projectile : mProjectiles) {
-        // Render the projectile
-        projectile -> render(renderer);
-    }
+    mProjectiles.removeInactive();
 }
 
 /**
@@ -92,15 +57,16 @@ void Player::render(SDL_Renderer* renderer) {
  */
 void Player::init() {
     /// Create and attach texture component
-    std::shared_ptr<TextureComponent> texture = std::make_shared<TextureComponent>();
+    std::shared_ptr<TextureComponent> texture = SceneArena::makeShared<TextureComponent>();
     texture -> CreateTextureComponent(mRenderer, "Assets/MainCharacter.bmp");  // Load texture for Player
     AddComponent(texture); // Add to ECS system
 
     /// Create and attach input component (handles player control input)
-    std::shared_ptr<InputComponent> input = std::make_shared<InputComponent>(speed, mRenderer);
+    std::shared_ptr<InputComponent> input = SceneArena::makeShared<InputComponent>(speed, mRenderer);
 
-    /// Create and attach collision component (handles collisions)
-    std::shared_ptr<Collision2DComponent> hitbox = std::make_shared<Collision2DComponent>();
+    /// Create and attach collision component (handles collisions), only hostile projectiles can hit the player
+    std::shared_ptr<Collision2DComponent> hitbox = SceneArena::makeShared<Collision2DComponent>();
+    hitbox -> setLayer(CollisionLayer::Player, CollisionLayer::HostileProjectile);
 
     /// Add default transform component (position, scale, rotation)
     AddDefaultTransform();
@@ -120,7 +86,7 @@ void Player::init() {
      * @details Reduces the effective hitbox to 50% of player
      * to make collisions feel fairer to the player.
      */
-    auto hitboxTransform = GetComponent<Collision2DComponent>(ComponentType::Collision2DComponent);
+    auto hitboxTransform = GetCollision();
     if (hitboxTransform) {
         hitboxTransform -> setHitboxModifier(0.5f, 0.5f);  ///< Set hitbox size to 50% of sprite dimensions
     }
@@ -1,234 +1,124 @@
 /**
  * @file Projectile.cpp
  * @brief Projectile class implementation
- * Handle projectile launching, movement, and rendering
+ * Handle projectile launching, volley spawning, and rendering
  */
 
 
 #include "Projectile.hpp"
+#include "ProjectileList.hpp"
 #include "Collision2DComponent.hpp"
-#include <iostream>
+#include "ResourceManager.hpp"
+#include "Logger.hpp"
 #include <cmath>
 
-Uint64 Projectile::lastTimeLaunch = 0;  ///< // Track last projectile launch time
-
 /**
  * @brief Constructor
- * @param renderer SDL renderer
  */
-Projectile::Projectile(SDL_Renderer* renderer) : GameEntity(mSpeed) {
-    mSpeed = 350.0f;       // Default 300 for projectile speed
-    mRenderer = renderer;
+Projectile::Projectile() : GameEntity(0.0f) {
     mRenderable = false;  // Projectiles are not rendered at the game start
 }
 
 /**
- * @brief Launch projectile with direction
+ * @brief Put the projectile in flight
  * @param x Start position X
  * @param y Start position Y
- * @param direction True = up, False = down
- * @param minLaunchTime Minimum time gap between launches (for player projectiles)
- * @return True if projectile is fired
+ * @param velocityX Horizontal velocity in pixels per second
+ * @param velocityY Vertical velocity in pixels per second (positive is downward)
  */
-bool Projectile::Launch(float x, float y, bool direction, float minLaunchTime) {
-    Uint64 currentTime = SDL_GetTicks(); // Get current time in milliseconds
-    auto ref = GetTransform();
-    /// If is a Player projectile and it has reached or pasted launch time
-    if (isPlayerProjectile && currentTime - lastTimeLaunch >= minLaunchTime) {
-        mIsFiring = true;           ///< Allows firing the projectile
-        mRenderable = true;         ///< Allows rendering the projectile
-        mYDirectionUp = direction;  ///< Fire at the direction given
-        lastTimeLaunch = currentTime; ///< Set the last launch time to current time
-
-        /// Resize the player projectile's width and height
-        ref -> setWidth(15);
-        ref -> setHeight(40);
-
-        /// Calculate the center to position projectiles
-        float projectileX = (ownerWidth / 2) - (ref ->getWidth() / 2);
-
-        ref -> move(x + projectileX, y - 10); ///< Launch the projectile slightly above the player (y - 10)
-        return true;
-        }
-
-        /// If is boss projectile (not projectile = enemy projectile), enable all status for firing
-        else if (!isPlayerProjectile && isBossProjectile) {
-            mIsFiring = true;
-            mRenderable = true;
-            mYDirectionUp = direction;
-
-            auto hitboxTransform = GetComponent<Collision2DComponent>(ComponentType::Collision2DComponent);
-            if (hitboxTransform) {
-                hitboxTransform -> setHitboxModifier(0.6f, 0.6f);  ///< Adjust the hitbox for hitbox forgiveness
-            }
-            return true;
-        }
-        /// If is enemy projectile, enable all status for firing
-        else if (!isPlayerProjectile) {
-            mIsFiring = true;
-            mRenderable = true;
-            mYDirectionUp = direction;
-            ref -> setWidth(8);
-            ref -> setHeight(26);
-            /// Rotate the arrow once to face downward (original texture faces upward)
-            ref -> setRotation(180.0f);
-            float projectileX = (ownerWidth / 2) - (ref ->getWidth() / 2);
-            ref -> move(x + projectileX, y + 10); // Launch the projectile slightly below the enemies (y + 10)
-            return true;
-        }
-        else {
-            return false;  ///< false if no projectile was fired
-        }
+void Projectile::launch(float x, float y, float velocityX, float velocityY) {
+    teleport(x, y);  ///< Placed, not moved: the hitbox must not sweep in from where it was set up
+    mVelocityX = velocityX;
+    mVelocityY = velocityY;
+    mIsFiring = true;    ///< Allows firing the projectile
+    mRenderable = true;  ///< Allows rendering the projectile
 }
 
-
 /**
- * @brief Launch projectile at an angle
- * @param x Start position X
- * @param y Start position Y
- * @param angleDegree Launch angle in degrees
+ * @brief Spawn one volley of a given kind
+ * @details Rows fly straight up or down at the volley's speed, fans are aimed by angle
  */
-void Projectile::LaunchWithAngle(float x, float y, float angleDegree) {
-    auto ref = GetTransform();
-    if (!ref) {
-        return;
-    }
-    ref -> move(x, y);
-    auto hitboxTransform = GetComponent<Collision2DComponent>(ComponentType::Collision2DComponent);
-    if (hitboxTransform) {
-        hitboxTransform -> setHitboxModifier(0.6f, 0.6f);  // Adjust the actual hitbox with percentage based modifiers
-    }
-
-    /**
-     * @brief convert degree to radians
-     * @details <math> expects radian as parameter for cos and sin functions,
-     * therefore convert degree to radians
-     */
-
-    float radians = angleDegree * (3.14159265f / 180.0f); ///< 1 degree is about 0.01744 radians (3.14159265f / 180.0f)
-
-    mVelocityX = std::cos(radians) * mSpeed;  ///< Times mSpeed to calculate movement
-    mVelocityY = std::sin(radians) * mSpeed;
-
-    mRenderable = true;
-    mIsFiring = true;
-
-}
+template <typename Kind>
+static void spawnVolleyOf(const VolleyDesc& desc, const std::shared_ptr<SDL_Texture>& texture, ProjectileList& out) {
+    ProjectileList::Batch<Kind>& batch = out.batch<Kind>();
+    batch.reserve(batch.size() + desc.count);
+
+    const float degreesToRadians = 3.14159265f / 180.0f;
+    for (int i = 0; i < desc.count; i++) {
+        std::shared_ptr<Kind> projectile = SceneArena::makeShared<Kind>();
+        projectile -> init();
+
+        std::shared_ptr<TextureComponent> sprite = SceneArena::makeShared<TextureComponent>();
+        sprite -> setTexture(texture);
+        projectile -> AddComponent(sprite);
+
+        /// Place and aim the projectile directly in its launched state
+        TransformComponent* transform = projectile -> GetTransform();
+        transform -> setWidth(desc.width);
+        transform -> setHeight(desc.height);
+        transform -> setRotation(desc.rotation);
+        if (desc.movement == ProjectileMovementType::UpDown) {
+            projectile -> launch(desc.originX + desc.spacingX * i, desc.originY, 0.0f, desc.upward ? -desc.speed : desc.speed);
+        } else {
+            float radians = (desc.angle + desc.angleStep * i) * degreesToRadians;
+            projectile -> launch(desc.originX, desc.originY, std::cos(radians) * desc.speed, std::sin(radians) * desc.speed);
+        }
 
+        Collision2DComponent* hitbox = projectile -> GetCollision();
+        hitbox -> setShape(desc.hitboxShape);
+        if (desc.hitboxScaleX > 0.0f && desc.hitboxScaleY > 0.0f) {
+            hitbox -> setHitboxModifier(desc.hitboxScaleX, desc.hitboxScaleY);  ///< Otherwise the kind's policy scale stays
+        }
 
-/**
- * @brief Launch tracking projectile at an angle
- * @param x Start position X
- * @param y Start position Y
- * @param angleDegree Launch angle in degrees
- * @note Same calculation as Angle, but separated to manage projectiles that tracks the player,
- */
-void Projectile::LaunchWithTracking(float x, float y, float angleDegree) {
-    auto ref = GetTransform();
-    if (!ref) {
-        return;
+        batch.push_back(std::move(projectile));
     }
-    ref -> move(x, y);
-    auto hitboxTransform = GetComponent<Collision2DComponent>(ComponentType::Collision2DComponent);
-    if (hitboxTransform) {
-        hitboxTransform -> setHitboxModifier(0.6f, 0.6f);
-    }
-
-    float radians = angleDegree * (3.14159265f / 180.0f);
-    mVelocityX = std::cos(radians) * mSpeed;
-    mVelocityY = std::sin(radians) * mSpeed;
-
-    mRenderable = true;
-    mIsFiring = true;
-
 }
 
 /**
- * @brief Update projectile movement
- * @param deltaTime Time elapsed since last frame
+ * @brief Spawn and launch a whole volley in one call
+ * @param desc Layout, sprite and hitbox of the volley
+ * @param renderer SDL renderer
+ * @param out Projectile list the volley is appended to
  */
-void Projectile::update(float deltaTime) {
-    auto ref = GetTransform();
-    if (!ref) {
+void Projectile::spawnVolley(const VolleyDesc& desc, SDL_Renderer* renderer, ProjectileList& out) {
+    if (desc.count <= 0) {
         return;
     }
-
-    if (!mIsFiring) {
-        return;
+    std::shared_ptr<SDL_Texture> texture = ResourceManager::LoadTexture(desc.sprite, renderer);
+    if (!texture) {
+        LOG_ERROR("Failed to load texture: %s", desc.sprite);
     }
 
-    float projectileMovement = mSpeed * deltaTime;
-    float newX = ref -> getX() + mVelocityX * deltaTime;
-    float newY = ref -> getY() + mVelocityY * deltaTime;
-    float rotationSpeed = 180.0f;
-    switch (mMovementType) {
+    /// The kind is decided once per volley: upward rows bounce at the top, tracking shots spin
+    switch (desc.movement) {
         case ProjectileMovementType::UpDown:
-            /// Checks if projectile is going up
-            if (mYDirectionUp) {
-                ref -> move(ref -> getX(), ref -> getY() - projectileMovement); ///< Move Up, SDL uses top-left configuration so Y = 0 is the top
+            if (desc.upward) {
+                spawnVolleyOf<RainShot>(desc, texture, out);
             } else {
-                ref -> move(ref -> getX(), ref -> getY() + projectileMovement); ///< Move down
+                spawnVolleyOf<BossShot>(desc, texture, out);
             }
             break;
         case ProjectileMovementType::Angle:
-            ref -> move(newX, newY);
+            spawnVolleyOf<BossShot>(desc, texture, out);
             break;
         case ProjectileMovementType::Tracking:
-            ref -> setRotation(ref -> getRotation() + rotationSpeed * deltaTime);
-            ref -> move(newX, newY);
+            spawnVolleyOf<SlashShot>(desc, texture, out);
             break;
-
-
-    }
-
-    /// Logic designed for Rain attack pattern, bounces back when they reach the top
-    if (isBossProjectile && mYDirectionUp && ref -> getY() <= 0) {
-        mYDirectionUp = false;
-        mSpeed *= 1.5f;
-        /// Rotate the projectile back to pointing downward once
-        GetTransform() -> setRotation(0.0f);
-
-    /// Stops all inactive projectiles from moving further and from appearing on screen
-    } else if (ref -> getY() < 0 || ref -> getY() > WINDOW_HEIGHT) {
-        mIsFiring = false;
-        setRenderable(false);
-    }
-
-    for (auto& component : mComponents) {
-        component.second -> update(deltaTime);
-    }
-}
-
-/**
- * @brief Render the projectile
- * @param renderer SDL renderer
- */
-void Projectile::render(SDL_Renderer* renderer) {
-    if (!mRenderable) {
-        return;
-    }
-    for (auto& component : mComponents) {
-        component.second -> render(renderer);
     }
 }
 
 /**
- * @brief Initialize projectile components
+ * @brief Add the transform and hitbox components
+ * @param layer Collision layer of the hitbox
+ * @param mask Layers the hitbox collides with
+ * @param scaleX Hitbox width relative to the sprite
+ * @param scaleY Hitbox height relative to the sprite
  */
-void Projectile::init() {
+void Projectile::initComponents(Uint32 layer, Uint32 mask, float scaleX, float scaleY) {
     // Create a Collision2DComponent for this projectile
-    std::shared_ptr<Collision2DComponent> hitbox = std::make_shared<Collision2DComponent>();
+    std::shared_ptr<Collision2DComponent> hitbox = SceneArena::makeShared<Collision2DComponent>();
+    hitbox -> setLayer(layer, mask);
+    hitbox -> setHitboxModifier(scaleX, scaleY);
     AddDefaultTransform(); // Add a TransformComponent to this projectile
     AddComponent(hitbox);
 }
-
-
-/**
- * @brief Set size for ultimate projectiles
- * @param width Width value
- * @param height Height value
- */
-void Projectile::setUltimateProjectileSize(float width, float height) {
-    mUltimateProjectileWidth = width;
-    mUltimateProjectileHeight = height;
-}
@@ -0,0 +1,56 @@
+/**
+ * @file RenderScaler.cpp
+ * @brief RenderScaler class implementation
+ * Pick the resolution of the scene layers from the frame timings
+ */
+
+#include "RenderScaler.hpp"
+#include "DebugOverlay.hpp"
+#include <algorithm>
+
+/// Number of frames the misses are counted over before the scale is reconsidered
+static const int WindowFrames = 30;
+
+/// Misses per window that make the scale drop a step
+static const int MissesToDrop = 3;
+
+/// Longest wait (in clean windows) before probing a higher scale again
+static const int MaxProbeDelay = 64;
+
+/**
+ * @brief Feed the timing of a finished frame and adjust the scale
+ * @details A frame only counts as a miss when drawing and presenting took at least as long
+ * as the simulation, since a lower resolution does nothing for a simulation bound frame
+ * @param timing Stage timings of the frame
+ * @param budgetMs Target frame period in milliseconds
+ */
+void RenderScaler::recordFrame(const FrameTiming& timing, double budgetMs) {
+    double drawMs = timing.renderMs + timing.presentMs;
+    if (timing.frameMs > budgetMs * 1.1 && drawMs >= timing.updateMs) {
+        mMisses++;
+    }
+    if (++mFrames < WindowFrames) {
+        return;
+    }
+
+    bool probing = mProbing;
+    mProbing = false;
+    if (mMisses >= MissesToDrop) {
+        /// A probe that missed: the higher scale is not sustainable, wait longer before the next one
+        if (probing) {
+            mProbeDelay = std::min(mProbeDelay * 2, MaxProbeDelay);
+        }
+        mScale = std::max(MinScale, mScale - ScaleStep);
+        mCleanWindows = 0;
+    } else if (mMisses == 0) {
+        if (++mCleanWindows >= mProbeDelay && mScale < MaxScale) {
+            mScale = std::min(MaxScale, mScale + ScaleStep);
+            mCleanWindows = 0;
+            mProbing = true;
+        }
+    } else {
+        mCleanWindows = 0;  ///< Occasional misses: hold the current scale
+    }
+    mFrames = 0;
+    mMisses = 0;
+}
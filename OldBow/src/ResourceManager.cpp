@@ -6,14 +6,22 @@
 
 
 #include "ResourceManager.hpp"
+#include "TextureLoader.hpp"
+#include "Logger.hpp"
 
 /// Store loaded textures
 std::unordered_map<std::string, std::shared_ptr<SDL_Texture>> ResourceManager::textureMap;
 
 
+/// Thread allowed to create textures, 0 until the application sets it
+SDL_threadID ResourceManager::renderThread = 0;
+
 /// Singleton instance
 ResourceManager* ResourceManager::instance = nullptr;
 
+/// Decodes images for preloadTexturesAsync()
+static TextureLoader loader;
+
 /**
  * @brief Load a texture from file or retrieve it from cache
  * @param filePath Path to the BMP file
@@ -27,10 +35,16 @@ std::shared_ptr<SDL_Texture> ResourceManager::LoadTexture(const std::string& fil
         return textureMap[filePath]; // Return the texture from hashmap
     }
 
+    /// Textures can only be created on the render thread, others must use preloaded ones
+    if (renderThread != 0 && SDL_ThreadID() != renderThread) {
+        LOG_ERROR("Texture %s was not preloaded and cannot be created off the render thread", filePath.c_str());
+        return nullptr;
+    }
+
     /// Load the BMP file into an SDL surface
     SDL_Surface* surface = SDL_LoadBMP(filePath.c_str());
     if (!surface) {
-        std::cerr << "Error loading BMP file: " << filePath << SDL_GetError() << std::endl;
+        LOG_ERROR("Error loading BMP file %s: %s", filePath.c_str(), SDL_GetError());
         return nullptr; // Exit the function if loading the BMP failed
     }
 
@@ -39,7 +53,7 @@ std::shared_ptr<SDL_Texture> ResourceManager::LoadTexture(const std::string& fil
     SDL_FreeSurface(surface); // Free the surface once the texture is created to avoid memory leaks
 
     if (!rawTexture) {
-        std::cerr << "Error creating texture: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Error creating texture %s: %s", filePath.c_str(), SDL_GetError());
         return nullptr; // Exit the function if creating raw texture failed
     }
 
@@ -51,3 +65,89 @@ std::shared_ptr<SDL_Texture> ResourceManager::LoadTexture(const std::string& fil
 
     return sdlTexture;
 }
+
+/**
+ * @brief Start decoding textures on the loader thread, without waiting for them
+ * @param filePaths Paths to the BMP files
+ */
+void ResourceManager::preloadTexturesAsync(const std::vector<std::string>& filePaths) {
+    for (const std::string& filePath : filePaths) {
+        if (textureMap.find(filePath) == textureMap.end()) {
+            loader.request(filePath);
+        }
+    }
+}
+
+/**
+ * @brief Upload some of the images decoded so far
+ * @param renderer SDL renderer
+ * @param maxCount Most textures created by this call
+ * @return Number of textures created
+ */
+int ResourceManager::uploadDecoded(SDL_Renderer* renderer, int maxCount) {
+    std::string filePath;
+    int uploaded = 0;
+    for (; uploaded < maxCount; uploaded++) {
+        SDL_Surface* surface = loader.take(filePath);
+        if (!surface) {
+            break;
+        }
+        AddTexture(filePath, surface, renderer);
+    }
+    return uploaded;
+}
+
+/**
+ * @brief Wait for every asynchronous preload and upload it
+ * @details Images that failed to decode are left out, LoadTexture() reports them when they are used
+ * @param renderer SDL renderer
+ */
+void ResourceManager::finishPreloads(SDL_Renderer* renderer) {
+    loader.waitIdle();
+    std::string filePath;
+    while (SDL_Surface* surface = loader.take(filePath)) {
+        AddTexture(filePath, surface, renderer);
+    }
+}
+
+/**
+ * @brief Stop the loader thread
+ */
+void ResourceManager::shutDown() {
+    loader.shutDown();
+}
+
+/**
+ * @brief Cache a texture from an image decoded elsewhere
+ * @param filePath Path the image was read from, used as the cache key
+ * @param surface Decoded image, freed by this call
+ * @param renderer SDL renderer
+ * @return Shared pointer to the cached texture
+ */
+std::shared_ptr<SDL_Texture> ResourceManager::AddTexture(const std::string& filePath, SDL_Surface* surface, SDL_Renderer* renderer) {
+    auto found = textureMap.find(filePath);
+    if (found != textureMap.end()) {
+        SDL_FreeSurface(surface);
+        return found -> second;
+    }
+
+    SDL_Texture* rawTexture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (!rawTexture) {
+        LOG_ERROR("Error creating texture %s: %s", filePath.c_str(), SDL_GetError());
+        return nullptr;
+    }
+    std::shared_ptr<SDL_Texture> sdlTexture(rawTexture, SDL_DestroyTexture);
+    textureMap[filePath] = sdlTexture;
+    return sdlTexture;
+}
+
+/**
+ * @brief Get a texture only if it is already cached
+ * @param filePath Path to the BMP file
+ * @return Shared pointer to the texture, nullptr if not cached
+ */
+std::shared_ptr<SDL_Texture> ResourceManager::GetCachedTexture(const std::string& filePath) {
+    auto found = textureMap.find(filePath);
+    return found != textureMap.end() ? found -> second : nullptr;
+}
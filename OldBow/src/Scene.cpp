@@ -9,8 +9,9 @@
 #include "Application.hpp"
 #include "TimeManager.hpp"
 #include "DialogueManager.hpp"
+#include "ResourceManager.hpp"
+#include "Logger.hpp"
 #include <cmath>
-#include <iostream>
 #include <algorithm>  // Access remove_if
 
 
@@ -21,7 +22,7 @@
  */
 void Scene::initMainCharacter() {
     /// Assign a texture component to main character, sets the movement speed to 400.0f
-    mainCharacter = std::make_shared<Player> (400.0f, mRenderer);
+    mainCharacter = SceneArena::makeShared<Player>(400.0f, mRenderer);
     mainCharacter -> init();
     auto transform = mainCharacter->GetTransform();
     if (transform) {
@@ -31,7 +32,7 @@ void Scene::initMainCharacter() {
         float heroPadding = WINDOW_HEIGHT * 0.1f;
         float x = WINDOW_WIDTH / 2 - heroWidth / 2;
         float y = WINDOW_HEIGHT - heroHeight - heroPadding + offsetY;
-        transform -> move(x, y);
+        mainCharacter -> teleport(x, y);
     }
 }
 
@@ -60,10 +61,11 @@ void Scene::initEnemies(int numTxComponents) {
             float y = i * txComponentY;
 
             /// Create an enemy and assigned the movement speed as 100.0f
-            std::shared_ptr<Enemy> enemy = std::make_shared<Enemy> (100.0f, mRenderer);
+            std::shared_ptr<Enemy> enemy = SceneArena::makeShared<Enemy>(100.0f, mRenderer);
             enemy -> init();  // Initialize
             /// Assign the calculated fixed position(x, y) for this enemy
-            enemy -> GetTransform() -> move(x, y);
+            enemy -> teleport(x, y);
+            enemy -> startTimers(mTimers);  // Start firing on the scene's timer wheel
 
             /// Store the enemy in the vector for later updates
             enemies.push_back(std::move(enemy));
@@ -98,7 +100,7 @@ void Scene::initBoss() {
 
     /// Load boss configuration from text file for each boss
     for (int i = 0; i < bossCount; ++i) {
-        std::shared_ptr<Boss> boss = std::make_shared<Boss>(mRenderer);
+        std::shared_ptr<Boss> boss = SceneArena::makeShared<Boss>(mRenderer);
         if (!boss) {
             return;
         }
@@ -117,10 +119,11 @@ void Scene::initBoss() {
         boss -> init();
 
         /// Position the boss near the top of screen, and separate them based on number of bosses
-        boss -> GetTransform() -> move(startX + i * spacing, 50);
+        boss -> teleport(startX + i * spacing, 50);
 
         /// Assign the player reference to the boss for target tracking and attack behaviors
         boss -> setPlayerReference(this -> mainCharacter);
+        boss -> startTimers(mTimers);  // Attack patterns and ultimate run on the scene's timer wheel
         mBosses.push_back(boss); // Add this boss to vector
     }
 }
@@ -161,20 +164,17 @@ void Scene::update(float deltaTime) {
      * enemies are not required to be clear (design choice)
      */
     if (mBosses.empty()) {
-        /// Enter dialogue mode for next plot
+        /// Enter dialogue mode for next plot, the dialogue loads its background so it is loaded on the main thread
         currentState = GameState::Dialogue;
-        if (mSceneType == SceneType::Boss1) {
-            dialogueManager.loadDialogueFromFile("Assets/SceneDialogue/Scene1End.txt",
-                                                 [this]() { SetSceneStatus(false); }, mRenderer);  // End scene when plot is finished
-
-        } else if (mSceneType == SceneType::Boss2) {
-            dialogueManager.loadDialogueFromFile("Assets/SceneDialogue/Scene2End.txt",
-                                                 [this]() { SetSceneStatus(false); }, mRenderer);
-
+        const char* dialogue = "Assets/SceneDialogue/Scene1End.txt";
+        if (mSceneType == SceneType::Boss2) {
+            dialogue = "Assets/SceneDialogue/Scene2End.txt";
         } else if (mSceneType == SceneType::Boss3) {
-            dialogueManager.loadDialogueFromFile("Assets/SceneDialogue/Scene3End.txt",
-                                                 [this]() { SetSceneStatus(false); }, mRenderer);
+            dialogue = "Assets/SceneDialogue/Scene3End.txt";
         }
+        runOnMainThread([this, dialogue]() {
+            dialogueManager.loadDialogueFromFile(dialogue, [this]() { SetSceneStatus(false); }, mRenderer);  // End scene when plot is finished
+        });
     }
 
     /// freeze all updates when not in Playing state (battle mode)
@@ -186,6 +186,9 @@ void Scene::update(float deltaTime) {
         deltaTime = 0.1f; // Limits deltaTime to avoid large frame time differences
     }
 
+    /// Run the shots and attack phases due this frame, before their shooters move
+    mTimers.advance(deltaTime);
+
     /**
      * @brief Update game entities and their projectiles
      */
@@ -196,32 +199,12 @@ void Scene::update(float deltaTime) {
     for (auto& enemy : enemies) {
         enemy -> update(deltaTime); // update enemy
     }
+    mParticles.update(deltaTime);  // Also resets the frame's particle budget
 
-    /**
-     * @brief For each boss in the vector, check if they are hit by player's projectile
-     */
-    for (auto& boss : mBosses) {
-        if (!boss -> getRenderable()) {
-            continue; // Skip already destroyed boss in the vector
-        }
-        for (auto& projectile : mainCharacter -> getPlayerProjectiles()) {
-            if (!projectile -> getRenderable()) {
-                continue;  // Skip inactive projectiles in the vector
-            }
-
-            /// Check collision between the boss and player's projectile
-            if (boss -> TestCollision(projectile)) {
-                boss -> onHit();      // Confirmed on hit, apply HP drop
-                /// Boss is dead if HP drops to and below 0
-                if (boss -> getHP() < 0) {
-                    boss -> setRenderable(false);
-                }
-                projectile -> setRenderable(false);  // Projectile is destroyed after hit
-                playerScore++;
-                break;
-            }
-        }
-    }
+    /// Move every hitbox to its entity's new position and find all contacts in one pass
+    syncColliders();
+    mCollisions.detect();
+    resolveContacts();
 
     /// Enemy movement calculations
     float enemySpeed = 100.0f;  // enemy default speed
@@ -229,29 +212,6 @@ void Scene::update(float deltaTime) {
     Enemy::totalEnemyMovement += enemySpeed * deltaTime; // The total amount moved in one direction (in pixels)
     Enemy::totalEnemyMovement = std::round(Enemy::totalEnemyMovement * 1000.0f) / 1000.0f; // Prevent floating-point drift
 
-    /**
-     * @brief For each enemy in the vector, check if they are hit by player's projectile
-     */
-    for (auto& enemy : enemies) {
-        if (!enemy -> getRenderable()) {
-            continue; // Skip already destroyed enemies in the vector
-        }
-        for (auto& projectile : mainCharacter -> getPlayerProjectiles()) {
-            if (!projectile -> getRenderable()) {
-                continue;  // Skip inactive projectiles in the vector
-            }
-
-            /// Check collision between the enemy and player's projectile
-            if (enemy -> TestCollision(projectile)) {
-                enemy -> onHit();                    // Confirmed on hit
-                projectile -> setRenderable(false); // Projectile is destroyed after hit
-                playerScore++;
-                break;
-            }
-        }
-    }
-
-
     /**
      *@brief Clean up inactive enemies in the vector,
      * and collect their orphaned projectiles
@@ -259,10 +219,8 @@ void Scene::update(float deltaTime) {
     for (auto iterator = enemies.begin(); iterator != enemies.end();) {
         /// If the enemy is already destroyed (not renderable)
         if (!(*iterator) -> getRenderable()) {
-            /// Transfer this enemy's remaining projectiles into global projectiles vector
-            for (auto& projectile : (*iterator) -> getProjectiles()) {
-                globalProjectiles.push_back(projectile);
-            }
+            /// Transfer this enemy's remaining projectiles into global projectiles
+            globalProjectiles.takeAll((*iterator) -> getProjectiles());
             /// Erase the enemy from vector
             iterator = enemies.erase(iterator);
         } else {
@@ -278,10 +236,8 @@ void Scene::update(float deltaTime) {
     for (auto iterator = mBosses.begin(); iterator != mBosses.end();) {
         /// If an boss is already destroyed (not renderable)
         if (!(*iterator) -> getRenderable()) {
-            /// Transfer this boss' remaining projectiles into global projectiles vector
-            for (auto& projectile : (*iterator) -> getProjectiles()) {
-                globalProjectiles.push_back(projectile);
-            }
+            /// Transfer this boss' remaining projectiles into global projectiles
+            globalProjectiles.takeAll((*iterator) -> getProjectiles());
             /// Erase this boss from vector
             iterator = mBosses.erase(iterator);
         } else {
@@ -305,138 +261,464 @@ void Scene::update(float deltaTime) {
     }
 
 
-    /**
-     * @brief Check if the player is hit by any projectile
-     * @details
-     * There are three kinds of projectiles that can kill the player:
-     * - Boss projectiles
-     * - Enemy (minion) projectiles
-     * - Orphaned projectiles from dead enemies/bosses
-     *
-     * Each is handled separately to show different dialogues.
-     */
+    /// Update movements and locations of global(orphaned) projectiles
+    globalProjectiles.update(deltaTime);
+
+    /// Everything has moved, decide what is drawn and which projectiles are gone
+    cullAndRetire();
+
+    /// Last in the frame, trails only get what hits and deaths left of the particle budget
+    emitTrails();
+
+    /// Erase memory for inactive global(orphaned) projectiles
+    globalProjectiles.removeInactive();
+}
+
+/**
+ * @brief Records everything the renderer needs from this frame
+ * @details Runs at the end of the simulated frame. The sprite list keeps the draw order of
+ * the texture pass: sprites first, then projectiles on top.
+ * @param snapshot Snapshot to fill, cleared first
+ */
+void Scene::buildSnapshot(FrameSnapshot& snapshot) const {
+    snapshot.clear();
+    snapshot.state = currentState;
+    snapshot.counts = getEntityCounts();
+
+    /// Nothing of the battle is drawn outside of the Playing state
+    if (currentState != GameState::Playing) {
+        return;
+    }
+    snapshot.background = backgroundTexture;
 
-    /// Check collision between boss' projectiles and player
+    std::vector<SpriteCommand>& sprites = snapshot.sprites;
+    mainCharacter -> recordSprite(sprites);
+    for (auto& enemy : enemies) {
+        if (enemy -> getRenderable() && enemy -> isOnScreen()) {
+            enemy -> recordSprite(sprites); // record each enemy only if they are renderable and visible
+        }
+    }
     for (auto& boss : mBosses) {
-        for (auto& projectile : boss -> getProjectiles()) {
-            /// If hit, set to Defeat state, load dialogue, and exit when finished
-            if (projectile->getRenderable() && projectile -> TestCollision(mainCharacter)) {
-                currentState = GameState::Defeat;
-                dialogueManager.loadDialogueFromFile("Assets/SceneDialogue/Death_byBosses.txt", []() { exit(0); }, mRenderer);
-            }
+        if (boss -> isOnScreen()) {
+            boss -> recordSprite(sprites);
         }
     }
 
-    /// Check collision between enemies' projectiles and player
-    for (auto& enemy : enemies) {
-        for (auto& projectile : enemy -> getProjectiles()) {
-            /// If hit, set to Defeat state, load dialogue, and exit when finished
-            if (projectile->getRenderable() && mainCharacter->TestCollision(projectile)) {
-                currentState = GameState::Defeat;
-                dialogueManager.loadDialogueFromFile("Assets/SceneDialogue/Death_byMinion.txt", []() { exit(0); }, mRenderer);
+    auto recordProjectiles = [&sprites](const ProjectileList& projectiles) {
+        projectiles.forEach([&sprites](Projectile& projectile) {
+            if (projectile.getRenderable() && projectile.isOnScreen()) {
+                projectile.recordSprite(sprites); // Record each projectile only if they are renderable
             }
-        }
+        });
+    };
+    for (auto& enemy : enemies) {
+        recordProjectiles(enemy -> getProjectiles());
     }
+    for (auto& boss : mBosses) {
+        recordProjectiles(boss -> getProjectiles());
+    }
+    recordProjectiles(globalProjectiles);
+    recordProjectiles(mainCharacter -> getPlayerProjectiles());
 
-    /// Check collision between orphaned projectiles and player
-    for (auto& projectile : globalProjectiles) {
-        /// If hit, set to Defeat state, load dialogue, and exit when finished
-        if (projectile -> getRenderable() && mainCharacter -> TestCollision(projectile)) {
-            currentState = GameState::Defeat;
-            dialogueManager.loadDialogueFromFile("Assets/SceneDialogue/Death_LingeringShot.txt", []() { exit(0); }, mRenderer);
+    mParticles.record(snapshot.particles);
+}
+
+/**
+ * @brief Collision pass, moves every hitbox of the scene to its entity's transform
+ * @details Every live entity and projectile is registered with the collision system,
+ * hostile projectiles are tagged with who fired them for the death dialogue
+ */
+void Scene::syncColliders() {
+    mCollisions.clear();
+    auto addEntity = [this](GameEntity& entity, ColliderTag tag) {
+        entity.syncCollider();
+        if (entity.getRenderable()) {
+            mCollisions.add(entity, static_cast<int>(tag));
         }
+    };
+
+    auto addProjectiles = [&addEntity](const ProjectileList& projectiles, ColliderTag tag) {
+        projectiles.forEach([&addEntity, tag](Projectile& projectile) { addEntity(projectile, tag); });
+    };
+
+    addEntity(*mainCharacter, ColliderTag::None);
+    addProjectiles(mainCharacter -> getPlayerProjectiles(), ColliderTag::None);
+    for (auto& enemy : enemies) {
+        addEntity(*enemy, ColliderTag::None);
+        addProjectiles(enemy -> getProjectiles(), ColliderTag::FiredByEnemy);
     }
+    for (auto& boss : mBosses) {
+        addEntity(*boss, ColliderTag::None);
+        addProjectiles(boss -> getProjectiles(), ColliderTag::FiredByBoss);
+    }
+    addProjectiles(globalProjectiles, ColliderTag::Lingering);
+}
 
-    /// Update movements and locations of global(orphaned) projectiles
-    for (auto& projectile : globalProjectiles) {
-        projectile -> update(deltaTime);
+/**
+ * @brief Check if a sprite overlaps the view rectangle
+ * @details Rotated sprites are tested with the square around their rotation circle,
+ * so a corner swinging into the view is never culled
+ */
+static bool overlapsView(const TransformComponent& transform, const SDL_FRect& view) {
+    float x = transform.getX();
+    float y = transform.getY();
+    float width = transform.getWidth();
+    float height = transform.getHeight();
+    if (transform.getRotation() != 0.0f) {
+        float radius = 0.5f * std::sqrt(width * width + height * height);
+        x += width / 2.0f - radius;
+        y += height / 2.0f - radius;
+        width = height = 2.0f * radius;
     }
+    return x + width > view.x && x < view.x + view.w &&
+           y + height > view.y && y < view.y + view.h;
+}
 
-    /// Erase memory for inactive global(orphaned) projectiles
-    for (auto iterator = globalProjectiles.begin(); iterator != globalProjectiles.end();) {
-        if (!(*iterator) -> getRenderable()) {
-            iterator = globalProjectiles.erase(iterator);
-        } else {
-            ++iterator;
+/**
+ * @brief Visibility pass over every live entity and projectile of the scene
+ * @details Each sprite is tested once against the view, which is also the play field.
+ * Entities outside are flagged so the frame snapshot skips them. Projectiles outside have left
+ * the play field (through any side, EX: angled spread shots) and are retired, so they
+ * stop being updated, drawn and collision tested.
+ */
+void Scene::cullAndRetire() {
+    const SDL_FRect view = { 0.0f, 0.0f, static_cast<float>(WINDOW_WIDTH), static_cast<float>(WINDOW_HEIGHT) };
+    mCulledCount = 0;
+
+    auto cullEntity = [this, &view](GameEntity& entity) {
+        const TransformComponent* transform = entity.GetTransform();
+        bool onScreen = !transform || overlapsView(*transform, view);
+        entity.setOnScreen(onScreen);
+        if (!onScreen && entity.getRenderable()) {
+            mCulledCount++;
         }
+    };
+    auto retireProjectiles = [this, &view](const ProjectileList& projectiles) {
+        projectiles.forEach([this, &view](Projectile& projectile) {
+            const TransformComponent* transform = projectile.GetTransform();
+            if (!projectile.getRenderable() || !transform || overlapsView(*transform, view)) {
+                return;
+            }
+            projectile.retire();
+            mRetiredCount++;
+        });
+    };
+
+    cullEntity(*mainCharacter);
+    retireProjectiles(mainCharacter -> getPlayerProjectiles());
+    for (auto& enemy : enemies) {
+        cullEntity(*enemy);
+        retireProjectiles(enemy -> getProjectiles());
+    }
+    for (auto& boss : mBosses) {
+        cullEntity(*boss);
+        retireProjectiles(boss -> getProjectiles());
     }
+    retireProjectiles(globalProjectiles);
 }
 
 /**
- * @brief Renders all game entities to the screen
- * @param renderer SDL renderer for drawing
+ * @brief Leave a trail particle behind every projectile in flight
+ * @details Spawned at the projectile's center, emission stops once the frame's particle budget is spent
  */
-void Scene::render(SDL_Renderer* renderer) {
-    /// Skip rendering if game is not in Playing state
-    if (currentState != GameState::Playing) {
-        return;
+void Scene::emitTrails() {
+    auto emitFor = [this](const ProjectileList& projectiles) {
+        projectiles.forEach([this](Projectile& projectile) {
+            const TransformComponent* transform = projectile.GetTransform();
+            if (projectile.getRenderable() && transform) {
+                mParticles.emit(ParticleEffect::Trail, transform -> getX() + transform -> getWidth() / 2.0f,
+                                transform -> getY() + transform -> getHeight() / 2.0f, 1);
+            }
+        });
+    };
+    emitFor(mainCharacter -> getPlayerProjectiles());
+    for (auto& boss : mBosses) {
+        emitFor(boss -> getProjectiles());
     }
-    /// Render background if available
-    if (backgroundTexture) {
-        SDL_RenderCopy(mRenderer, backgroundTexture, NULL, NULL);
+    for (auto& enemy : enemies) {
+        emitFor(enemy -> getProjectiles());
     }
+    emitFor(globalProjectiles);
+}
 
-    /// Render main character
-    mainCharacter -> render(mRenderer);
+/**
+ * @brief Apply this frame's contacts to the game
+ * @details
+ * - Player projectiles hit bosses first, then enemies. A projectile is used up by its first hit,
+ *   and each boss / enemy takes at most one hit per frame.
+ * - A hostile projectile touching the player ends the run. The death dialogue follows
+ *   who fired it, lingering shots from dead shooters take precedence, then enemies, then bosses.
+ */
+void Scene::resolveContacts() {
+    const std::vector<Contact>& contacts = mCollisions.getContacts();
+    const Collider* target;
+    const Collider* shot;
+
+    /// Player projectiles against bosses, then against enemies
+    mTargetHit.clear();
+    for (Uint32 targetLayer : { CollisionLayer::Boss, CollisionLayer::Enemy }) {
+        for (const Contact& contact : contacts) {
+            if (!mCollisions.match(contact, targetLayer, CollisionLayer::PlayerProjectile, target, shot)) {
+                continue;
+            }
+            auto* enemy = static_cast<Enemy*>(target -> entity);
+            if (!shot -> entity -> getRenderable() || !enemy -> getRenderable() ||
+                std::find(mTargetHit.begin(), mTargetHit.end(), enemy) != mTargetHit.end()) {
+                continue;  // Projectile already used, or this target was already hit this frame
+            }
+            mTargetHit.push_back(enemy);
 
-    /// Render all active enemies
-    for (auto& enemy : enemies) {
-        if (enemy -> getRenderable()) {
-            enemy -> render(mRenderer); // render each enemy only if they are renderable
+            enemy -> onHit();  // Confirmed on hit, apply HP drop
+            /// Boss is dead if HP drops to and below 0
+            if (targetLayer == CollisionLayer::Boss && static_cast<Boss*>(enemy) -> getHP() < 0) {
+                enemy -> setRenderable(false);
+            }
+
+            /// Sparks where the arrow landed, a burst if the target is destroyed
+            const TransformComponent* arrow = shot -> entity -> GetTransform();
+            mParticles.emit(ParticleEffect::HitSpark, arrow -> getX() + arrow -> getWidth() / 2.0f, arrow -> getY(), 10);
+            if (!enemy -> getRenderable()) {
+                const TransformComponent* body = enemy -> GetTransform();
+                mParticles.emit(ParticleEffect::DeathBurst, body -> getX() + body -> getWidth() / 2.0f,
+                                body -> getY() + body -> getHeight() / 2.0f, targetLayer == CollisionLayer::Boss ? 150 : 40);
+            }
+            shot -> entity -> setRenderable(false);  // Projectile is destroyed after hit
+            playerScore++;
         }
     }
 
-    /// Render all bosses
+    /// Hostile projectiles against the player
+    ColliderTag killer = ColliderTag::None;
+    for (const Contact& contact : contacts) {
+        if (mCollisions.match(contact, CollisionLayer::Player, CollisionLayer::HostileProjectile, target, shot)) {
+            killer = std::max(killer, static_cast<ColliderTag>(shot -> tag));
+        }
+    }
+
+    /// If hit, set to Defeat state, load dialogue, and retry from the checkpoint when finished
+    if (killer != ColliderTag::None) {
+        currentState = GameState::Defeat;
+        const char* dialogue = "Assets/SceneDialogue/Death_byBosses.txt";
+        if (killer == ColliderTag::Lingering) {
+            dialogue = "Assets/SceneDialogue/Death_LingeringShot.txt";
+        } else if (killer == ColliderTag::FiredByEnemy) {
+            dialogue = "Assets/SceneDialogue/Death_byMinion.txt";
+        }
+        runOnMainThread([this, dialogue]() {
+            dialogueManager.loadDialogueFromFile(dialogue, [this]() { restoreCheckpoint(); }, mRenderer);
+        });
+    }
+}
+
+/**
+ * @brief Save the scene state when combat starts
+ * @details Called by the start dialogue, on the main thread while the simulation is idle.
+ * Nothing has moved or fired yet, so positions, HP and fire intervals are all the scene needs.
+ */
+void Scene::takeCheckpoint() {
+    Checkpoint& checkpoint = mCheckpoint;
+    checkpoint.bosses.clear();
+    checkpoint.enemies.clear();
+
+    auto transform = mainCharacter -> GetTransform();
+    checkpoint.playerX = transform -> getX();
+    checkpoint.playerY = transform -> getY();
     for (auto& boss : mBosses) {
-        boss -> render(mRenderer);
+        auto bossTransform = boss -> GetTransform();
+        checkpoint.bosses.push_back({ boss -> getDefinition(), bossTransform -> getX(), bossTransform -> getY(), boss -> getHP() });
+    }
+    for (auto& enemy : enemies) {
+        auto enemyTransform = enemy -> GetTransform();
+        checkpoint.enemies.push_back({ enemyTransform -> getX(), enemyTransform -> getY(), enemy -> getFireInterval() });
+    }
+
+    checkpoint.enemyMovement = Enemy::movement;
+    checkpoint.enemyTotalMovement = Enemy::totalEnemyMovement;
+    checkpoint.enemyMovementThreshold = Enemy::movementThreshold;
+    checkpoint.enemyMovingRight = Enemy::enemyMovingRight;
+    checkpoint.directionEngine = Boss::directionEngine();
+    checkpoint.fireIntervalEngine = Enemy::fireIntervalEngine();
+    checkpoint.spawnedPhaseEnemies = spawnedPhaseEnemies;
+    checkpoint.playerScore = playerScore;
+    checkpoint.valid = true;
+}
+
+/**
+ * @brief Rewind to the checkpoint and resume combat
+ * @details Called by the death dialogue, on the main thread while the simulation is idle.
+ * The current entities go back to the arena's free lists and the checkpoint's are rebuilt
+ * from them, their textures are already in the resource cache. Without a checkpoint the
+ * application is asked to quit.
+ */
+void Scene::restoreCheckpoint() {
+    if (!mCheckpoint.valid) {
+        /// Quit the way closing the window does, so the application still shuts down cleanly
+        LOG_ERROR("No checkpoint to restore, quitting");
+        SDL_Event quit{};
+        quit.type = SDL_QUIT;
+        SDL_PushEvent(&quit);
+        return;
+    }
+    const Checkpoint& checkpoint = mCheckpoint;
+
+    /// Drop the defeated attempt, timers first as they reference its entities
+    mTimers.clear();
+    mParticles.clear();
+    globalProjectiles.clear();
+    enemies.clear();
+    mBosses.clear();
+    mainCharacter.reset();
+
+    initMainCharacter();
+    mainCharacter -> teleport(checkpoint.playerX, checkpoint.playerY);
+    for (const auto& state : checkpoint.bosses) {
+        std::shared_ptr<Boss> boss = SceneArena::makeShared<Boss>(mRenderer);
+        boss -> applyDefinition(state.definition);
+        boss -> init();
+        boss -> teleport(state.x, state.y);
+        boss -> setHP(state.hp);
+        boss -> setPlayerReference(this -> mainCharacter);
+        boss -> startTimers(mTimers);
+        mBosses.push_back(std::move(boss));
+    }
+    for (const auto& state : checkpoint.enemies) {
+        std::shared_ptr<Enemy> enemy = SceneArena::makeShared<Enemy>(100.0f, mRenderer);
+        enemy -> init();
+        enemy -> teleport(state.x, state.y);
+        enemy -> setFireInterval(state.fireInterval);
+        enemy -> startTimers(mTimers);
+        enemies.push_back(std::move(enemy));
     }
 
-    /// Render all global projectiles
-    for (auto& projectile : globalProjectiles) {
-        projectile -> render(mRenderer);
+    /// Restored after the entities, their constructors draw from the random engines
+    Enemy::movement = checkpoint.enemyMovement;
+    Enemy::totalEnemyMovement = checkpoint.enemyTotalMovement;
+    Enemy::movementThreshold = checkpoint.enemyMovementThreshold;
+    Enemy::enemyMovingRight = checkpoint.enemyMovingRight;
+    Boss::directionEngine() = checkpoint.directionEngine;
+    Enemy::fireIntervalEngine() = checkpoint.fireIntervalEngine;
+    spawnedPhaseEnemies = checkpoint.spawnedPhaseEnemies;
+    playerScore = checkpoint.playerScore;
+
+    currentState = GameState::Playing;
+}
+
+/**
+ * @brief Queue work that needs the renderer (EX: loading a dialogue background)
+ * @param job Work to run on the main thread after this frame's simulation
+ */
+void Scene::runOnMainThread(std::function<void()> job) {
+    mMainThreadJobs.push_back(std::move(job));
+}
+
+/**
+ * @brief Run the work queued by the last simulated frame
+ * @details Called by the main thread once the simulation thread has finished the frame
+ */
+void Scene::runMainThreadJobs() {
+    /// Swap first, a job may queue more work for the next frame
+    std::vector<std::function<void()>> jobs;
+    jobs.swap(mMainThreadJobs);
+    for (auto& job : jobs) {
+        job();
     }
+}
 
-    /// Render all player projectiles
-    for (auto& projectile : mainCharacter -> getPlayerProjectiles()) {
-        if (projectile -> getRenderable()) {
-            projectile -> render(mRenderer); // Render each projectile only if they are renderable
+/**
+ * @brief Counts live entities and projectiles by owner, for the debug overlay
+ * @return Entity counts of the scene
+ */
+SceneEntityCounts Scene::getEntityCounts() const {
+    SceneEntityCounts counts;
+    for (const auto& enemy : enemies) {
+        if (enemy -> getRenderable()) {
+            counts.enemies++;
+        }
+        counts.enemyProjectiles += static_cast<int>(enemy -> getProjectiles().size());
+    }
+    for (const auto& boss : mBosses) {
+        if (boss -> getRenderable()) {
+            counts.bosses++;
         }
+        counts.bossProjectiles += static_cast<int>(boss -> getProjectiles().size());
     }
+    if (mainCharacter) {
+        counts.playerProjectiles = static_cast<int>(mainCharacter -> getPlayerProjectiles().size());
+    }
+    counts.globalProjectiles = static_cast<int>(globalProjectiles.size());
+    counts.culled = mCulledCount;
+    counts.retired = mRetiredCount;
+    counts.particles = mParticles.getLiveCount();
+    return counts;
 }
 
 /**
- * @brief Starts up the scene by resetting state and initializing game entities
+ * @brief Starts up the scene: starts the opening dialogue and begins loading the battle
+ * @details Only the dialogue is needed for the first frames. The battle textures are decoded on
+ * the loader thread while it plays, and the entities are created by prepareBattle() when it ends.
  * @param renderer SDL renderer for drawing
  */
 void Scene::SceneStartUp(SDL_Renderer* renderer) {
     /// Reset leftover values from previous scene (deltaTime calculation included)
     resetSceneState();
 
+    /// Every entity spawned from now on lives in this scene's arena
+    SceneArena::setCurrent(&mArena);
+    mCulledCount = 0;
+    mRetiredCount = 0;
+    mBattleReady = false;
+
     mRenderer = renderer; // Save the renderer for use in enemies/player
 
     /**
-     * @brief Load background and initial dialogues based on scene type
+     * @brief Start the opening dialogue first, so its script and background are loaded before anything else
      * @details loadDialogueFromFile loads both dialogues and a background for the dialogue mode,
-     * bgPath sets background for the battle scene,
-     * therefore two backgrounds are loaded at the start of a scene
+     * mBattleBackground sets background for the battle scene
      */
-    std::string bgPath;
-    if (mSceneType == SceneType::Boss1) {
-        dialogueManager.loadDialogueFromFile("Assets/SceneDialogue/Scene1Start.txt", [this]() { currentState = GameState::Playing; },mRenderer);
-        bgPath = "Assets/background1.bmp"; // Sets background for the scene 1 battle
-    } else if (mSceneType == SceneType::Boss2) {
-        dialogueManager.loadDialogueFromFile("Assets/SceneDialogue/Scene2Start.txt", [this]() { currentState = GameState::Playing; },mRenderer);
-        bgPath = "Assets/background2.bmp"; // Sets background for the scene 2 battle
+    const char* startDialogue = "Assets/SceneDialogue/Scene1Start.txt";
+    const char* endDialogue = "Assets/SceneDialogue/Scene1End.txt";
+    mBattleBackground = "Assets/background1.bmp"; // Sets background for the scene 1 battle
+    if (mSceneType == SceneType::Boss2) {
+        startDialogue = "Assets/SceneDialogue/Scene2Start.txt";
+        endDialogue = "Assets/SceneDialogue/Scene2End.txt";
+        mBattleBackground = "Assets/background2.bmp"; // Sets background for the scene 2 battle
     } else if (mSceneType == SceneType::Boss3) {
-        dialogueManager.loadDialogueFromFile("Assets/SceneDialogue/Scene3Start.txt", [this]() { currentState = GameState::Playing; },mRenderer);
-        bgPath = "Assets/background3.bmp"; // Sets background for the scene 3 battle
+        startDialogue = "Assets/SceneDialogue/Scene3Start.txt";
+        endDialogue = "Assets/SceneDialogue/Scene3End.txt";
+        mBattleBackground = "Assets/background3.bmp"; // Sets background for the scene 3 battle
     }
+    dialogueManager.loadDialogueFromFile(startDialogue, [this]() { prepareBattle(); takeCheckpoint(); currentState = GameState::Playing; }, mRenderer);
+
+    /// Battle sprites and background, decoded while the dialogue plays
+    ResourceManager::preloadTexturesAsync({ mBattleBackground, "Assets/MainCharacter.bmp", "Assets/arrow.bmp", "Assets/Arrow.bmp",
+                                            "Assets/UndeadArchers.bmp", "Assets/EvilSpikes.bmp", "Assets/SoulReaper.bmp",
+                                            "Assets/fireball.bmp", "Assets/CursedFire.bmp", "Assets/Slash.bmp" });
+
+    /**
+     * @brief Prefetch every dialogue this battle can end with
+     * @details Queued after the start dialogue, so it is parsed first
+     */
+    dialogueManager.prefetch({ endDialogue, "Assets/SceneDialogue/Death_byBosses.txt",
+                               "Assets/SceneDialogue/Death_byMinion.txt",
+                               "Assets/SceneDialogue/Death_LingeringShot.txt" }, mRenderer);
+}
 
-    /// Load background texture
-    SDL_Surface* bgSurface = SDL_LoadBMP(bgPath.c_str());
-    backgroundTexture = SDL_CreateTextureFromSurface(mRenderer, bgSurface);
-    SDL_FreeSurface(bgSurface);
+/**
+ * @brief Create what the battle needs, called when the opening dialogue ends
+ * @details Waits only for the textures the loader has not decoded yet (EX: the dialogue was
+ * clicked through). Sprites spawned during the battle are created on the simulation thread,
+ * which cannot create textures, so every one of them is in the cache once this returns.
+ */
+void Scene::prepareBattle() {
+    if (mBattleReady) {
+        return;
+    }
+    mBattleReady = true;
+    ResourceManager::finishPreloads(mRenderer);
+    mParticles.init(mRenderer);
 
+    /// Background texture, owned by the resource cache
+    backgroundTexture = ResourceManager::LoadTexture(mBattleBackground, mRenderer).get();
 
     /// Initialize player and bosses
     initMainCharacter();
@@ -447,6 +729,34 @@ void Scene::SceneStartUp(SDL_Renderer* renderer) {
     }
 }
 
+/**
+ * @brief Shuts down the scene, destroys its entities and resets its arena
+ * @details Entities only own their components, so dropping the containers destroys everything.
+ * The arena then releases all of its memory in one go.
+ */
+void Scene::SceneShutDown() {
+    mBattleReady = false;
+    mTimers.clear();  // Pending callbacks hold references into the arena
+    mCheckpoint = Checkpoint{};
+    mParticles.clear();
+    globalProjectiles.clear();
+    enemies.clear();
+    mBosses.clear();
+    mainCharacter.reset();
+
+    SceneArena::Stats stats = mArena.getStats();
+    LOG_INFO("Scene %d arena: %llu allocations, %llu KB allocated, peak %llu KB live, %llu KB reserved",
+             static_cast<int>(mSceneType) + 1, static_cast<unsigned long long>(stats.allocations),
+             static_cast<unsigned long long>(stats.bytesAllocated / 1024),
+             static_cast<unsigned long long>(stats.peakLiveBytes / 1024),
+             static_cast<unsigned long long>(stats.reservedBytes / 1024));
+    mArena.reset();
+
+    if (SceneArena::current() == &mArena) {
+        SceneArena::setCurrent(nullptr);
+    }
+}
+
 /**
  * @brief Resets all scene-specific static and global variables
  */
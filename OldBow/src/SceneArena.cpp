@@ -0,0 +1,119 @@
+/**
+ * @file SceneArena.cpp
+ * @brief SceneArena class implementation
+ * Per-scene chunk arena with size-class free lists
+ */
+
+#include "SceneArena.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <new>
+
+/// Arena of the active scene
+SceneArena* SceneArena::sCurrent = nullptr;
+
+/**
+ * @brief Destructor, returns every chunk to the system
+ */
+SceneArena::~SceneArena() {
+    if (sCurrent == this) {
+        sCurrent = nullptr;
+    }
+    for (char* chunk : mChunks) {
+        ::operator delete(chunk);
+    }
+}
+
+/**
+ * @brief Allocate a block
+ * @param bytes Size of the block
+ * @param alignment Alignment of the block
+ * @return Pointer to the block
+ */
+void* SceneArena::allocate(std::size_t bytes, std::size_t alignment) {
+    std::size_t rounded = (std::max<std::size_t>(bytes, 1) + SizeClassStep - 1) / SizeClassStep * SizeClassStep;
+    void* block = nullptr;
+
+    if (rounded <= MaxPooledSize && alignment <= SizeClassStep) {
+        /// Reuse a freed block of the same size class if there is one
+        FreeBlock*& head = mFreeLists[rounded / SizeClassStep - 1];
+        if (head) {
+            block = head;
+            head = head -> next;
+        } else {
+            block = allocateFromChunk(rounded, SizeClassStep);
+        }
+    } else {
+        block = allocateFromChunk(rounded, alignment);
+    }
+
+    mStats.allocations++;
+    mStats.bytesAllocated += rounded;
+    mStats.liveAllocations++;
+    mStats.liveBytes += rounded;
+    mStats.peakLiveBytes = std::max(mStats.peakLiveBytes, mStats.liveBytes);
+    return block;
+}
+
+/**
+ * @brief Free a block
+ * @param pointer Block returned by allocate()
+ * @param bytes Size passed to allocate()
+ */
+void SceneArena::deallocate(void* pointer, std::size_t bytes) {
+    if (!pointer) {
+        return;
+    }
+    std::size_t rounded = (std::max<std::size_t>(bytes, 1) + SizeClassStep - 1) / SizeClassStep * SizeClassStep;
+    if (rounded <= MaxPooledSize) {
+        FreeBlock* block = static_cast<FreeBlock*>(pointer);
+        FreeBlock*& head = mFreeLists[rounded / SizeClassStep - 1];
+        block -> next = head;
+        head = block;
+    }
+    mStats.liveAllocations--;
+    mStats.liveBytes -= rounded;
+}
+
+/**
+ * @brief Release every chunk at once
+ * @return True if the arena was reset
+ */
+bool SceneArena::reset() {
+    if (mStats.liveAllocations > 0) {
+        LOG_WARNING("Scene arena still has %llu live allocations, keeping its memory",
+                    static_cast<unsigned long long>(mStats.liveAllocations));
+        return false;
+    }
+    for (char* chunk : mChunks) {
+        ::operator delete(chunk);
+    }
+    mChunks.clear();
+    mCursor = mEnd = nullptr;
+    mFreeLists.fill(nullptr);
+    mStats = Stats{};
+    return true;
+}
+
+/**
+ * @brief Bump allocate from the current chunk, reserving a new chunk if needed
+ */
+void* SceneArena::allocateFromChunk(std::size_t bytes, std::size_t alignment) {
+    std::size_t space = static_cast<std::size_t>(mEnd - mCursor);
+    void* cursor = mCursor;
+    if (!mCursor || !std::align(alignment, bytes, cursor, space)) {
+        /// Oversized blocks get a chunk of their own
+        std::size_t chunkSize = std::max(ChunkSize, bytes + alignment);
+        char* chunk = static_cast<char*>(::operator new(chunkSize));
+        mChunks.push_back(chunk);
+        mStats.reservedBytes += chunkSize;
+        mCursor = chunk;
+        mEnd = chunk + chunkSize;
+
+        space = chunkSize;
+        cursor = mCursor;
+        std::align(alignment, bytes, cursor, space);
+    }
+    mCursor = static_cast<char*>(cursor) + bytes;
+    return cursor;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file SimulationThread.cpp
+ * @brief SimulationThread class implementation
+ * Fork / join worker thread built on SDL threads
+ */
+
+#include "SimulationThread.hpp"
+
+/**
+ * @brief Constructor, starts the worker thread
+ */
+SimulationThread::SimulationThread() {
+    mMutex = SDL_CreateMutex();
+    mJobReady = SDL_CreateCond();
+    mJobDone = SDL_CreateCond();
+    if (mMutex && mJobReady && mJobDone) {
+        mThread = SDL_CreateThread(run, "Simulation", this);
+    }
+    if (!mThread) {
+        SDL_Log("Failed to start the simulation thread, simulating on the main thread: %s", SDL_GetError());
+    }
+}
+
+/**
+ * @brief Destructor, waits for the current job and stops the worker thread
+ */
+SimulationThread::~SimulationThread() {
+    if (mThread) {
+        SDL_LockMutex(mMutex);
+        mStopping = true;
+        SDL_CondSignal(mJobReady);
+        SDL_UnlockMutex(mMutex);
+        SDL_WaitThread(mThread, nullptr);  ///< Lets the current job finish first
+    }
+    SDL_DestroyCond(mJobDone);
+    SDL_DestroyCond(mJobReady);
+    SDL_DestroyMutex(mMutex);
+}
+
+/**
+ * @brief Run a job on the worker thread
+ * @param job Work to run
+ */
+void SimulationThread::start(std::function<void()> job) {
+    if (!mThread) {
+        job();  ///< No worker, fall back to running in sequence
+        return;
+    }
+    SDL_LockMutex(mMutex);
+    mJob = std::move(job);
+    mBusy = true;
+    SDL_CondSignal(mJobReady);
+    SDL_UnlockMutex(mMutex);
+}
+
+/**
+ * @brief Block until the job given to start() has finished
+ */
+void SimulationThread::wait() {
+    if (!mThread) {
+        return;
+    }
+    SDL_LockMutex(mMutex);
+    while (mBusy) {
+        SDL_CondWait(mJobDone, mMutex);
+    }
+    SDL_UnlockMutex(mMutex);
+}
+
+/**
+ * @brief Worker thread body: run jobs until asked to stop
+ * @param data The SimulationThread that owns this thread
+ */
+int SimulationThread::run(void* data) {
+    SimulationThread* self = static_cast<SimulationThread*>(data);
+    SDL_LockMutex(self -> mMutex);
+    while (true) {
+        while (!self -> mBusy && !self -> mStopping) {
+            SDL_CondWait(self -> mJobReady, self -> mMutex);
+        }
+        if (!self -> mBusy) {
+            break;  ///< Stopping with nothing left to do
+        }
+
+        /// Run the job without holding the lock, so wait() can block on the condition
+        std::function<void()> job = std::move(self -> mJob);
+        SDL_UnlockMutex(self -> mMutex);
+        job();
+        SDL_LockMutex(self -> mMutex);
+
+        self -> mBusy = false;
+        SDL_CondSignal(self -> mJobDone);
+    }
+    SDL_UnlockMutex(self -> mMutex);
+    return 0;
+}
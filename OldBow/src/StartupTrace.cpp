@@ -0,0 +1,114 @@
+/**
+ * @file StartupTrace.cpp
+ * @brief StartupTrace class implementation
+ * Time the start up phases and report the time to first frame
+ */
+
+#include "StartupTrace.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <cstdio>
+
+/// One timed phase or task
+struct TraceEntry {
+    const char* name;
+    double ms;
+    bool overlapped;  ///< Ran on another thread
+};
+
+/// Most phases and tasks kept, later ones are dropped
+static const int MaxEntries = 24;
+
+static TraceEntry entries[MaxEntries];
+static int entryCount = 0;
+static Uint64 startCounter = 0;
+static Uint64 lastMark = 0;
+static bool finished = false;
+
+/**
+ * @brief Keep one entry
+ */
+static void addEntry(const char* name, double ms, bool overlapped) {
+    if (entryCount < MaxEntries) {
+        entries[entryCount++] = { name, ms, overlapped };
+    }
+}
+
+/**
+ * @brief Start timing
+ * @details The performance counter works before SDL_Init, so SDL's own start up is timed too
+ */
+void StartupTrace::begin() {
+    startCounter = lastMark = SDL_GetPerformanceCounter();
+    entryCount = 0;
+    finished = false;
+}
+
+/**
+ * @brief Check if the report was logged
+ */
+bool StartupTrace::isFinished() {
+    return finished;
+}
+
+/**
+ * @brief Get milliseconds elapsed since begin()
+ */
+double StartupTrace::elapsedMs() {
+    return (SDL_GetPerformanceCounter() - startCounter) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+/**
+ * @brief Close the current phase
+ * @param phase Name of the phase that just ended
+ */
+void StartupTrace::mark(const char* phase) {
+    if (finished) {
+        return;
+    }
+    Uint64 now = SDL_GetPerformanceCounter();
+    addEntry(phase, (now - lastMark) * 1000.0 / SDL_GetPerformanceFrequency(), false);
+    lastMark = now;
+}
+
+/**
+ * @brief Report work that ran on another thread
+ * @param task Name of the work
+ * @param ms Time the work took, in milliseconds
+ */
+void StartupTrace::record(const char* task, double ms) {
+    if (!finished) {
+        addEntry(task, ms, true);
+    }
+}
+
+/**
+ * @brief Close the last phase and log the report
+ * @details Phases are packed into as few lines as fit, the logger rate limits each call site
+ * @param phase Name of the last phase
+ */
+void StartupTrace::finish(const char* phase) {
+    if (finished) {
+        return;
+    }
+    mark(phase);
+    finished = true;
+
+    char line[140];
+    int length = 0;
+    for (int i = 0; i < entryCount; i++) {
+        char item[64];
+        int itemLength = std::snprintf(item, sizeof(item), "%s%s %.1f ms", entries[i].name,
+                                       entries[i].overlapped ? " (worker)" : "", entries[i].ms);
+        itemLength = std::min(itemLength, static_cast<int>(sizeof(item)) - 1);
+        if (length > 0 && length + 2 + itemLength >= static_cast<int>(sizeof(line))) {
+            LOG_INFO("Start up: %s", line);
+            length = 0;
+        }
+        length += std::snprintf(line + length, sizeof(line) - length, "%s%s", length > 0 ? ", " : "", item);
+    }
+    if (length > 0) {
+        LOG_INFO("Start up: %s", line);
+    }
+    LOG_INFO("Time to first frame: %.1f ms", elapsedMs());
+}
@@ -0,0 +1,132 @@
+/**
+ * @file TextureLoader.cpp
+ * @brief TextureLoader class implementation
+ * Decode images on a worker thread, the render thread uploads them
+ */
+
+#include "TextureLoader.hpp"
+#include "Logger.hpp"
+
+/**
+ * @brief Queue an image for decoding
+ * @param filePath Path to the BMP file
+ */
+void TextureLoader::request(const std::string& filePath) {
+    if (!mThread) {
+        mMutex = SDL_CreateMutex();
+        mWork = SDL_CreateCond();
+        mIdle = SDL_CreateCond();
+        mThread = SDL_CreateThread(run, "TextureLoader", this);
+        if (!mThread) {
+            LOG_ERROR("Could not start the texture loader: %s", SDL_GetError());
+            return;
+        }
+    }
+    SDL_LockMutex(mMutex);
+    if (mRequested.insert(filePath).second) {
+        mQueue.push_back(filePath);
+        SDL_CondSignal(mWork);
+    }
+    SDL_UnlockMutex(mMutex);
+}
+
+/**
+ * @brief Take one decoded image, if any is waiting
+ * @param path Set to the image path
+ * @return Surface now owned by the caller, nullptr if none is waiting
+ */
+SDL_Surface* TextureLoader::take(std::string& path) {
+    if (!mThread) {
+        return nullptr;
+    }
+    SDL_Surface* surface = nullptr;
+    SDL_LockMutex(mMutex);
+    if (!mDecoded.empty()) {
+        path = std::move(mDecoded.back().first);
+        surface = mDecoded.back().second;
+        mDecoded.pop_back();
+    }
+    SDL_UnlockMutex(mMutex);
+    return surface;
+}
+
+/**
+ * @brief Block until every requested image is decoded
+ */
+void TextureLoader::waitIdle() {
+    if (!mThread) {
+        return;
+    }
+    SDL_LockMutex(mMutex);
+    while (!mQueue.empty() || mBusy) {
+        SDL_CondWait(mIdle, mMutex);
+    }
+    SDL_UnlockMutex(mMutex);
+}
+
+/**
+ * @brief Stop the worker thread and free every surface still waiting
+ */
+void TextureLoader::shutDown() {
+    if (!mThread) {
+        return;
+    }
+    SDL_LockMutex(mMutex);
+    mStopping = true;
+    SDL_CondSignal(mWork);
+    SDL_UnlockMutex(mMutex);
+    SDL_WaitThread(mThread, nullptr);
+    mThread = nullptr;
+
+    for (auto& decoded : mDecoded) {
+        SDL_FreeSurface(decoded.second);
+    }
+    mDecoded.clear();
+    mRequested.clear();
+    mQueue.clear();
+    mStopping = false;
+    SDL_DestroyCond(mIdle);
+    SDL_DestroyCond(mWork);
+    SDL_DestroyMutex(mMutex);
+    mIdle = nullptr;
+    mWork = nullptr;
+    mMutex = nullptr;
+}
+
+/**
+ * @brief Worker thread body: decode queued images until asked to stop
+ * @param data The TextureLoader that owns this thread
+ */
+int TextureLoader::run(void* data) {
+    TextureLoader* self = static_cast<TextureLoader*>(data);
+    SDL_LockMutex(self -> mMutex);
+    while (true) {
+        while (self -> mQueue.empty() && !self -> mStopping) {
+            SDL_CondBroadcast(self -> mIdle);
+            SDL_CondWait(self -> mWork, self -> mMutex);
+        }
+        if (self -> mStopping) {
+            break;
+        }
+        std::string filePath = std::move(self -> mQueue.front());
+        self -> mQueue.pop_front();
+        self -> mBusy = true;
+        SDL_UnlockMutex(self -> mMutex);
+
+        /// File read and decoding happen without the lock
+        SDL_Surface* surface = SDL_LoadBMP(filePath.c_str());
+        if (!surface) {
+            LOG_ERROR("Error loading BMP file %s: %s", filePath.c_str(), SDL_GetError());
+        }
+
+        SDL_LockMutex(self -> mMutex);
+        self -> mBusy = false;
+        if (surface) {
+            self -> mDecoded.emplace_back(filePath, surface);
+        }
+    }
+    self -> mBusy = false;
+    SDL_CondBroadcast(self -> mIdle);
+    SDL_UnlockMutex(self -> mMutex);
+    return 0;
+}
@@ -6,8 +6,8 @@
 
 #include "TimeManager.hpp"
 
-/// Store last update time in milliseconds
-Uint32 TimeManager::lastUpdateTime = 0;
+/// Store last update time as a performance counter value
+Uint64 TimeManager::lastUpdateTime = 0;
 
 /**
  * @brief Reset last update timestamp
@@ -15,5 +15,17 @@ Uint32 TimeManager::lastUpdateTime = 0;
  * is used to help reset game status during scene switching
  */
 void TimeManager::resetLastUpdateTime() {
-    lastUpdateTime = SDL_GetTicks();
+    lastUpdateTime = SDL_GetPerformanceCounter();
+}
+
+/**
+ * @brief Get the time elapsed between the last update and a given time
+ * @param now Performance counter value
+ * @return Elapsed time in seconds, with sub-millisecond precision
+ */
+float TimeManager::getDeltaTime(Uint64 now) {
+    if (now <= lastUpdateTime) {
+        return 0.0f;
+    }
+    return static_cast<float>(static_cast<double>(now - lastUpdateTime) / SDL_GetPerformanceFrequency());
 }
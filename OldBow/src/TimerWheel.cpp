@@ -0,0 +1,100 @@
+/**
+ * @file TimerWheel.cpp
+ * @brief TimerWheel class implementation
+ * Hierarchical timer wheel stepping in 1 ms ticks of simulation time
+ */
+
+#include "TimerWheel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+/**
+ * @brief Run a callback once after a delay
+ * @param delay Delay in seconds of simulation time
+ * @param callback Work to run when the delay has elapsed
+ */
+void TimerWheel::schedule(float delay, Callback callback) {
+    /// Round to the nearest tick, never earlier than the next one
+    double ticks = std::round(std::max(delay, 0.0f) / TickSeconds);
+    Uint64 delayTicks = std::max<Uint64>(1, static_cast<Uint64>(std::min<double>(ticks, MaxDelayTicks)));
+    insert({ mNow + delayTicks, std::move(callback) });
+    mPending++;
+}
+
+/**
+ * @brief Put a timer in the slot matching its expiry
+ * @details The level is the lowest one whose span holds both the current tick and the expiry,
+ * so the timer is cascaded down exactly when the clock enters its span
+ */
+void TimerWheel::insert(Timer&& timer) {
+    int level = 0;
+    while (level < LevelCount - 1 &&
+           (timer.expiry >> (LevelBits * (level + 1))) != (mNow >> (LevelBits * (level + 1)))) {
+        level++;
+    }
+    int slot = static_cast<int>((timer.expiry >> (LevelBits * level)) & (SlotCount - 1));
+    mSlots[level][slot].push_back(std::move(timer));
+}
+
+/**
+ * @brief Move the clock forward and run every callback that became due
+ * @param deltaTime Simulation time elapsed since last update (in seconds)
+ */
+void TimerWheel::advance(float deltaTime) {
+    mRemainder += deltaTime / TickSeconds;
+    double whole = std::floor(mRemainder);
+    mRemainder -= whole;
+    Uint64 ticks = static_cast<Uint64>(whole);
+
+    /// Nothing is waiting, only the clock moves
+    if (mPending == 0) {
+        mNow += ticks;
+        return;
+    }
+    for (Uint64 i = 0; i < ticks; i++) {
+        tick();
+    }
+}
+
+/**
+ * @brief Advance the clock by one tick and fire what is due
+ */
+void TimerWheel::tick() {
+    mNow++;
+
+    /// Entering a new span of a level: find the highest level crossed, then cascade from the top down
+    int crossed = 0;
+    while (crossed < LevelCount - 1 && (mNow & ((Uint64(1) << (LevelBits * (crossed + 1))) - 1)) == 0) {
+        crossed++;
+    }
+    for (int level = crossed; level > 0; level--) {
+        std::vector<Timer>& slot = mSlots[level][(mNow >> (LevelBits * level)) & (SlotCount - 1)];
+        mDue.swap(slot);
+        for (Timer& timer : mDue) {
+            insert(std::move(timer));
+        }
+        mDue.clear();
+    }
+
+    /// Fire the timers of this tick, swapped out first as callbacks may schedule more timers
+    mDue.swap(mSlots[0][mNow & (SlotCount - 1)]);
+    mPending -= mDue.size();
+    for (Timer& timer : mDue) {
+        timer.callback();
+    }
+    mDue.clear();
+}
+
+/**
+ * @brief Drop every pending timer without running it
+ */
+void TimerWheel::clear() {
+    for (auto& level : mSlots) {
+        for (auto& slot : level) {
+            slot.clear();
+        }
+    }
+    mDue.clear();
+    mPending = 0;
+}
@@ -7,17 +7,38 @@
 
 #define SDL_MAIN_HANDLED ///< fixes the WinMain() problem in windows system
 #include "Application.hpp"
+#include "StartupTrace.hpp"
+#include "Logger.hpp"
 #include <iostream>
+#include <cstring>
+#include <cstdlib>
 
 int main(int argc, char* argv[]) {
+    StartupTrace::begin();  ///< Time to first frame is measured from here
+    Logger::start();        ///< Errors are written on a background thread from now on
+
+    /// Optional command line: --fps <n> to change the target frame rate, --vsync to present with vsync
+    int targetFPS = 60;
+    bool vsync = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            targetFPS = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--vsync") == 0) {
+            vsync = true;
+        }
+    }
 
     try {
         Application app;
+        app.setVSync(vsync);
+        StartupTrace::mark("vsync");
         app.startUp();
-        app.loop(60);
+        app.loop(targetFPS);
     } catch (const std::runtime_error& e) {
+        Logger::shutDown();
         std::cerr << "Error:" << e.what() << std::endl;
         return 1;
     }
+    Logger::shutDown();  ///< Every thread that logs has stopped with the application
     return 0;
 }
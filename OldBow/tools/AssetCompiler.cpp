@@ -0,0 +1,148 @@
+/**
+ * @file AssetCompiler.cpp
+ * @brief Offline compiler for boss and dialogue files
+ * @details Validates the data-driven text assets and writes a compact ".bin" blob next to each one,
+ * which the game loads with a single read instead of parsing text at runtime.
+ *
+ * Build and run from the OldBow folder:
+ * @code
+ * g++ -std=c++17 -I"./include" ./tools/AssetCompiler.cpp ./src/CompiledAssets.cpp -o AssetCompiler
+ * ./AssetCompiler                 # validate and compile every asset the game ships
+ * ./AssetCompiler --check         # validate only, write nothing
+ * ./AssetCompiler --boss Assets/Boss1.txt --dialogue Assets/SceneDialogue/Scene1Start.txt
+ * @endcode
+ * The exit code is non-zero if any file fails validation, so it can gate a release build.
+ */
+
+#include "CompiledAssets.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    /// Boss files the game loads in Scene::initBoss
+    const char* DefaultBossFiles[] = {
+        "Assets/Boss1.txt",
+        "Assets/Boss2.txt",
+        "Assets/Boss3.txt"
+    };
+
+    /// Dialogue files the game loads in Scene
+    const char* DefaultDialogueFiles[] = {
+        "Assets/SceneDialogue/MainMenu.txt",
+        "Assets/SceneDialogue/Scene1Start.txt",
+        "Assets/SceneDialogue/Scene1End.txt",
+        "Assets/SceneDialogue/Scene2Start.txt",
+        "Assets/SceneDialogue/Scene2End.txt",
+        "Assets/SceneDialogue/Scene3Start.txt",
+        "Assets/SceneDialogue/Scene3End.txt",
+        "Assets/SceneDialogue/Death_byBosses.txt",
+        "Assets/SceneDialogue/Death_byMinion.txt",
+        "Assets/SceneDialogue/Death_LingeringShot.txt"
+    };
+
+    /**
+     * @brief Warn if a referenced asset file does not exist
+     * @details Missing images are only a warning, the game falls back to an empty texture.
+     */
+    void warnIfMissing(const std::string& owner, const std::string& path) {
+        if (!path.empty() && !std::ifstream(path).is_open()) {
+            std::cerr << owner << ": warning: referenced file '" << path << "' not found\n";
+        }
+    }
+
+    /**
+     * @brief Validate one boss file and write its blob
+     * @return True if the file is valid (and written, unless checkOnly)
+     */
+    bool compileBoss(const std::string& path, bool checkOnly) {
+        CompiledAssets::BossDefinition definition;
+        std::vector<std::string> errors;
+        if (!CompiledAssets::parseBossText(path, definition, errors)) {
+            for (const std::string& error : errors) {
+                std::cerr << error << "\n";
+            }
+            return false;
+        }
+        warnIfMissing(path, definition.texturePath);
+        if (checkOnly) {
+            return true;
+        }
+        std::string output = CompiledAssets::compiledPath(path);
+        if (!CompiledAssets::writeBossBinary(output, definition)) {
+            std::cerr << output << ": could not write file\n";
+            return false;
+        }
+        std::cout << path << " -> " << output << "\n";
+        return true;
+    }
+
+    /**
+     * @brief Validate one dialogue file and write its blob
+     * @return True if the file is valid (and written, unless checkOnly)
+     */
+    bool compileDialogue(const std::string& path, bool checkOnly) {
+        CompiledAssets::DialogueScript script;
+        std::vector<std::string> errors;
+        if (!CompiledAssets::parseDialogueText(path, script, errors)) {
+            for (const std::string& error : errors) {
+                std::cerr << error << "\n";
+            }
+            return false;
+        }
+        warnIfMissing(path, script.backgroundPath);
+        if (checkOnly) {
+            return true;
+        }
+        std::string output = CompiledAssets::compiledPath(path);
+        if (!CompiledAssets::writeDialogueBinary(output, script)) {
+            std::cerr << output << ": could not write file\n";
+            return false;
+        }
+        std::cout << path << " -> " << output << "\n";
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bool checkOnly = false;
+    std::vector<std::string> bossFiles;
+    std::vector<std::string> dialogueFiles;
+
+    /// Parse command line options
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--check") == 0) {
+            checkOnly = true;
+        } else if (std::strcmp(argv[i], "--boss") == 0 && i + 1 < argc) {
+            bossFiles.push_back(argv[++i]);
+        } else if (std::strcmp(argv[i], "--dialogue") == 0 && i + 1 < argc) {
+            dialogueFiles.push_back(argv[++i]);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--check] [--boss <file>]... [--dialogue <file>]...\n";
+            return 2;
+        }
+    }
+
+    /// No explicit files: compile everything the game ships
+    if (bossFiles.empty() && dialogueFiles.empty()) {
+        bossFiles.assign(std::begin(DefaultBossFiles), std::end(DefaultBossFiles));
+        dialogueFiles.assign(std::begin(DefaultDialogueFiles), std::end(DefaultDialogueFiles));
+    }
+
+    int failures = 0;
+    for (const std::string& path : bossFiles) {
+        failures += compileBoss(path, checkOnly) ? 0 : 1;
+    }
+    for (const std::string& path : dialogueFiles) {
+        failures += compileDialogue(path, checkOnly) ? 0 : 1;
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " file(s) failed validation\n";
+        return 1;
+    }
+    return 0;
+}